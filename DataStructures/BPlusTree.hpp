@@ -0,0 +1,491 @@
+/** @file BPlusTree.hpp
+ *  @brief Class definition of a B+ tree
+ *
+ *  Every node fills NodeBytes, a multiple of the cache line: a few
+ *  lines by default, a page for trees larger than the caches. Inner
+ *  nodes only route, every element lives in a leaf and the leaves
+ *  are linked in order, so a range scan walks contiguous arrays
+ *  instead of climbing the tree. Inner node keys are separators: the
+ *  subtree left of a separator holds elements not greater than it,
+ *  the subtree on its right elements not lower than it, which allows
+ *  equal elements. Nodes come from a NodePool, aligned to the cache
+ *  line, and the tree is walked iteratively with the links it went
+ *  through kept on a fixed stack of BPLUS_TREE_MAX_HEIGHT entries.
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+#ifndef BPLUSTREE_HPP_
+#define BPLUSTREE_HPP_
+
+/***********************************************************
+ *                 std includes
+***********************************************************/
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/***********************************************************
+ *               internal includes
+***********************************************************/
+#include "../Misc/NodePool.hpp"
+#include "../Misc/constants.hpp"
+
+template < typename T, std::size_t NodeBytes = BPLUS_TREE_NODE_BYTES >
+/** @class BPlusTree
+ *  @brief This class define an ordered multiset stored in a B+ tree.
+ *         Elements are inserted, never modified in place.
+ */
+class BPlusTree final {
+    static_assert(0 == NodeBytes % CACHE_LINE_SIZE, "Nodes are made of whole cache lines");
+    struct Leaf;
+public:
+    /** @class ConstIterator
+     *  @brief Forward iterator over the elements in order
+     */
+    class ConstIterator final {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        ConstIterator() = default;
+        auto operator*() const -> reference {
+            return m_leaf->keys[m_index];
+        }
+        auto operator->() const -> pointer {
+            return &m_leaf->keys[m_index];
+        }
+        auto operator++() -> ConstIterator& {
+            if (++m_index == m_leaf->count) {
+                m_leaf = m_leaf->next;
+                m_index = 0;
+            }
+            return *this;
+        }
+        auto operator++(int) -> ConstIterator {
+            auto copy = *this;
+            ++(*this);
+            return copy;
+        }
+        auto operator==( const ConstIterator &other ) const -> bool {
+            return m_leaf == other.m_leaf && m_index == other.m_index;
+        }
+        auto operator!=( const ConstIterator &other ) const -> bool {
+            return !(*this == other);
+        }
+    private:
+        friend class BPlusTree;
+        const Leaf *m_leaf {nullptr};
+        std::size_t m_index {0};
+        /** @brief : Position index of a leaf, past its end is the first
+         *           element of the next leaf
+         */
+        ConstIterator( const Leaf *leaf, const std::size_t index ) : m_leaf(leaf), m_index(index) {
+            if (nullptr != m_leaf && m_index == m_leaf->count) {
+                m_leaf = m_leaf->next;
+                m_index = 0;
+            }
+        }
+    }; // class ConstIterator
+    using const_iterator = ConstIterator;
+    using iterator = ConstIterator;
+    /** @class Range
+     *  @brief Pair of iterators usable in a range-based for loop
+     */
+    class Range final {
+    public:
+        Range( const ConstIterator &first, const ConstIterator &last ) : m_first(first), m_last(last) {}
+        auto begin() const -> ConstIterator {
+            return m_first;
+        }
+        auto end() const -> ConstIterator {
+            return m_last;
+        }
+        auto empty() const -> bool {
+            return m_first == m_last;
+        }
+    private:
+        ConstIterator m_first, m_last;
+    }; // class Range
+    /***************************************************************************//**
+    * @brief : Constructor
+    *
+    * @param : none
+    ******************************************************************************/
+    BPlusTree() = default;
+    /***************************************************************************//**
+    * @brief : Destructor
+    *
+    * @param : none
+    ******************************************************************************/
+    ~BPlusTree();
+    BPlusTree( const BPlusTree & ) = delete;
+    auto operator=( const BPlusTree & ) -> BPlusTree& = delete;
+    /***************************************************************************//**
+    * @brief : Insert element to the tree, after the elements equal to it
+    *
+    * @param in: data  - data of T type
+    ******************************************************************************/
+    auto insert( const T &data ) -> void;
+    /***************************************************************************//**
+    * @brief : Find an element equal to data
+    *
+    * @param in : data  - data of T type
+    * @return   : ConstIterator - first element equal to data, end() if none
+    ******************************************************************************/
+    auto find( const T &data ) const -> ConstIterator;
+    /***************************************************************************//**
+    * @brief : Verify if an element equals data
+    *
+    * @param in : data  - data of T type
+    * @return   : true if find would not return end()
+    ******************************************************************************/
+    auto contains( const T &data ) const -> bool;
+    /***************************************************************************//**
+    * @brief : First element not lower than data
+    *
+    * @param in : data  - data of T type
+    * @return   : ConstIterator - element, end() if every element is lower
+    ******************************************************************************/
+    auto lower_bound( const T &data ) const -> ConstIterator;
+    /***************************************************************************//**
+    * @brief : First element greater than data
+    *
+    * @param in : data  - data of T type
+    * @return   : ConstIterator - element, end() if no element is greater
+    ******************************************************************************/
+    auto upper_bound( const T &data ) const -> ConstIterator;
+    /***************************************************************************//**
+    * @brief : Elements in [low, high), in order
+    *
+    * @param in : low  - first value of the range
+    * @param in : high - end of the range, excluded
+    * @return   : Range - lower_bound(low) to lower_bound(high)
+    ******************************************************************************/
+    auto range( const T &low, const T &high ) const -> Range;
+    /***************************************************************************//**
+    * @brief : Delete all elements of the tree
+    *
+    * @param - none
+    ******************************************************************************/
+    auto clear() -> void;
+    /***************************************************************************//**
+    * @brief : Number of elements
+    *
+    * @param  : none
+    * @return : std::size_t - number of elements
+    ******************************************************************************/
+    auto size() const -> std::size_t;
+    /***************************************************************************//**
+    * @brief : Verify if the tree is empty
+    *
+    * @param  : none
+    * @return : Return true if size() is 0
+    ******************************************************************************/
+    auto empty() const -> bool;
+    /***************************************************************************//**
+    * @brief : Number of levels, the leaves included
+    *
+    * @param  : none
+    * @return : std::size_t - height of the tree, 0 when empty
+    ******************************************************************************/
+    auto height() const -> std::size_t;
+    auto begin() const -> ConstIterator;
+    auto end() const -> ConstIterator;
+    auto cbegin() const -> ConstIterator;
+    auto cend() const -> ConstIterator;
+    // elements held by a node of about NodeBytes, at least three so that
+    // splits make progress
+    static constexpr std::size_t LEAF_CAPACITY =
+        ((NodeBytes - 2 * sizeof(void*)) / sizeof(T) > 3) ?
+        (NodeBytes - 2 * sizeof(void*)) / sizeof(T) : 3;
+    static constexpr std::size_t INNER_CAPACITY =
+        ((NodeBytes - 2 * sizeof(void*)) / (sizeof(T) + sizeof(void*)) > 3) ?
+        (NodeBytes - 2 * sizeof(void*)) / (sizeof(T) + sizeof(void*)) : 3;
+private:
+    /** @struct Leaf
+     *  @brief Elements of the tree in order and the next leaf
+     */
+    struct alignas(CACHE_LINE_SIZE) Leaf {
+        std::uint32_t count {0};
+        Leaf *next {nullptr};
+        T keys[LEAF_CAPACITY];
+    }; // struct Leaf
+    /** @struct Inner
+     *  @brief Separators and count + 1 children, leaves on the last
+     *         inner level and inner nodes above
+     */
+    struct alignas(CACHE_LINE_SIZE) Inner {
+        std::uint32_t count {0};
+        T keys[INNER_CAPACITY];
+        void *children[INNER_CAPACITY + 1];
+    }; // struct Inner
+
+    void *m_root {nullptr};
+    Leaf *m_first {nullptr};
+    std::size_t m_size {0},
+                m_levels {0};
+    NodePool<Leaf> m_leaves;
+    NodePool<Inner> m_inners;
+    /***************************************************************************//**
+    * @brief : Descend to the leaf that may hold data
+    *
+    * @param in: data  - data of T type
+    * @param in: upper - follow the separators equal to data to the right
+    * @return  : Leaf* - leaf of the last level, nullptr when empty
+    ******************************************************************************/
+    auto leafOf( const T &data, const bool upper ) const -> Leaf*;
+    /***************************************************************************//**
+    * @brief : Insert a separator and the child on its right in an inner
+    *          node that has room
+    *
+    * @param in: node  - inner node, count < INNER_CAPACITY
+    * @param in: index - position of the separator
+    * @param in: key   - separator
+    * @param in: child - child right of the separator
+    ******************************************************************************/
+    static auto place( Inner *node, const std::size_t index, T &key, void *child ) -> void;
+    /***************************************************************************//**
+    * @brief : Split a full leaf while inserting data
+    *
+    * @param in : leaf  - full leaf
+    * @param in : index - position of data in the leaf
+    * @param in : data  - data of T type
+    * @param out: key   - separator of the new leaf
+    * @return   : Leaf* - new leaf, right of leaf
+    ******************************************************************************/
+    auto splitLeaf( Leaf *leaf, const std::size_t index, const T &data, T &key ) -> Leaf*;
+    /***************************************************************************//**
+    * @brief : Split a full inner node while inserting a separator
+    *
+    * @param in    : node  - full inner node
+    * @param in    : index - position of the separator
+    * @param in,out: key   - separator to insert, then separator moved up
+    * @param in    : child - child right of the separator
+    * @return      : Inner* - new inner node, right of node
+    ******************************************************************************/
+    auto splitInner( Inner *node, const std::size_t index, T &key, void *child ) -> Inner*;
+}; // class BPlusTree
+/***********************************************************
+ *                Functions definition
+************************************************************/
+template < typename T, std::size_t NodeBytes >
+BPlusTree<T, NodeBytes>::~BPlusTree() {
+    clear();
+}
+
+template < typename T, std::size_t NodeBytes >
+auto BPlusTree<T, NodeBytes>::insert( const T &data ) -> void {
+    if (nullptr == m_root) {
+        m_first = m_leaves.create();
+        m_root = m_first;
+        m_levels = 1;
+    }
+    Inner *path[BPLUS_TREE_MAX_HEIGHT];
+    std::size_t slots[BPLUS_TREE_MAX_HEIGHT];
+    std::size_t depth(0);
+    auto node = m_root;
+    for ( auto level = m_levels; level > 1; --level ) {
+        auto inner = static_cast<Inner*>(node);
+        const auto index = std::upper_bound(inner->keys, inner->keys + inner->count, data) - inner->keys;
+        path[depth] = inner;
+        slots[depth++] = static_cast<std::size_t>(index);
+        node = inner->children[index];
+    }
+    auto leaf = static_cast<Leaf*>(node);
+    const auto index = static_cast<std::size_t>(std::upper_bound(leaf->keys, leaf->keys + leaf->count, data) - leaf->keys);
+    m_size++;
+    if (leaf->count < LEAF_CAPACITY) {
+        std::move_backward(leaf->keys + index, leaf->keys + leaf->count, leaf->keys + leaf->count + 1);
+        leaf->keys[index] = data;
+        leaf->count++;
+        return;
+    }
+    T key;
+    void *child = splitLeaf(leaf, index, data, key);
+    while (0 != depth) {
+        auto inner = path[--depth];
+        if (inner->count < INNER_CAPACITY) {
+            place(inner, slots[depth], key, child);
+            return;
+        }
+        child = splitInner(inner, slots[depth], key, child);
+    }
+    // the root split, the tree grows one level
+    auto root = m_inners.create();
+    root->count = 1;
+    root->keys[0] = std::move(key);
+    root->children[0] = m_root;
+    root->children[1] = child;
+    m_root = root;
+    m_levels++;
+}
+
+template < typename T, std::size_t NodeBytes >
+auto BPlusTree<T, NodeBytes>::splitLeaf( Leaf *leaf, const std::size_t index, const T &data, T &key ) -> Leaf* {
+    auto right = m_leaves.create();
+    // the left leaf keeps half of the elements, data included
+    const std::size_t half = (LEAF_CAPACITY + 1) / 2;
+    const auto from = (index < half) ? half - 1 : half;
+    std::move(leaf->keys + from, leaf->keys + LEAF_CAPACITY, right->keys);
+    right->count = static_cast<std::uint32_t>(LEAF_CAPACITY - from);
+    leaf->count = static_cast<std::uint32_t>(from);
+    auto target = (index < half) ? leaf : right;
+    const auto position = (index < half) ? index : index - half;
+    std::move_backward(target->keys + position, target->keys + target->count, target->keys + target->count + 1);
+    target->keys[position] = data;
+    target->count++;
+    right->next = leaf->next;
+    leaf->next = right;
+    key = right->keys[0];
+    return right;
+}
+
+template < typename T, std::size_t NodeBytes >
+auto BPlusTree<T, NodeBytes>::place( Inner *node, const std::size_t index, T &key, void *child ) -> void {
+    std::move_backward(node->keys + index, node->keys + node->count, node->keys + node->count + 1);
+    std::move_backward(node->children + index + 1, node->children + node->count + 1, node->children + node->count + 2);
+    node->keys[index] = std::move(key);
+    node->children[index + 1] = child;
+    node->count++;
+}
+
+template < typename T, std::size_t NodeBytes >
+auto BPlusTree<T, NodeBytes>::splitInner( Inner *node, const std::size_t index, T &key, void *child ) -> Inner* {
+    // lay the INNER_CAPACITY + 1 separators out in order, then cut in the middle
+    T keys[INNER_CAPACITY + 1];
+    void *children[INNER_CAPACITY + 2];
+    std::move(node->keys, node->keys + index, keys);
+    keys[index] = std::move(key);
+    std::move(node->keys + index, node->keys + INNER_CAPACITY, keys + index + 1);
+    std::copy(node->children, node->children + index + 1, children);
+    children[index + 1] = child;
+    std::copy(node->children + index + 1, node->children + INNER_CAPACITY + 1, children + index + 2);
+    const std::size_t middle = (INNER_CAPACITY + 1) / 2;
+    auto right = m_inners.create();
+    std::move(keys, keys + middle, node->keys);
+    std::copy(children, children + middle + 1, node->children);
+    node->count = static_cast<std::uint32_t>(middle);
+    std::move(keys + middle + 1, keys + INNER_CAPACITY + 1, right->keys);
+    std::copy(children + middle + 1, children + INNER_CAPACITY + 2, right->children);
+    right->count = static_cast<std::uint32_t>(INNER_CAPACITY - middle);
+    key = std::move(keys[middle]);
+    return right;
+}
+
+template < typename T, std::size_t NodeBytes >
+auto BPlusTree<T, NodeBytes>::leafOf( const T &data, const bool upper ) const -> Leaf* {
+    auto node = m_root;
+    for ( auto level = m_levels; level > 1; --level ) {
+        auto inner = static_cast<Inner*>(node);
+        const auto end = inner->keys + inner->count;
+        const auto key = upper ? std::upper_bound(inner->keys, end, data)
+                               : std::lower_bound(inner->keys, end, data);
+        node = inner->children[key - inner->keys];
+    }
+    return static_cast<Leaf*>(node);
+}
+
+template < typename T, std::size_t NodeBytes >
+auto BPlusTree<T, NodeBytes>::find( const T &data ) const -> ConstIterator {
+    const auto itr = lower_bound(data);
+    return (end() != itr && !(data < *itr)) ? itr : end();
+}
+
+template < typename T, std::size_t NodeBytes >
+auto BPlusTree<T, NodeBytes>::contains( const T &data ) const -> bool {
+    return end() != find(data);
+}
+
+template < typename T, std::size_t NodeBytes >
+auto BPlusTree<T, NodeBytes>::lower_bound( const T &data ) const -> ConstIterator {
+    const auto leaf = leafOf(data, false);
+    if (nullptr == leaf) return end();
+    // past the end of the leaf is the first element of the next one
+    return ConstIterator(leaf, std::lower_bound(leaf->keys, leaf->keys + leaf->count, data) - leaf->keys);
+}
+
+template < typename T, std::size_t NodeBytes >
+auto BPlusTree<T, NodeBytes>::upper_bound( const T &data ) const -> ConstIterator {
+    const auto leaf = leafOf(data, true);
+    if (nullptr == leaf) return end();
+    return ConstIterator(leaf, std::upper_bound(leaf->keys, leaf->keys + leaf->count, data) - leaf->keys);
+}
+
+template < typename T, std::size_t NodeBytes >
+auto BPlusTree<T, NodeBytes>::range( const T &low, const T &high ) const -> Range {
+    if (!(low < high)) return Range(end(), end());
+    return Range(lower_bound(low), lower_bound(high));
+}
+
+template < typename T, std::size_t NodeBytes >
+auto BPlusTree<T, NodeBytes>::clear() -> void {
+    if (!std::is_trivially_destructible<T>::value && nullptr != m_root) {
+        for ( auto leaf = m_first; nullptr != leaf; ) {
+            auto next = leaf->next;
+            leaf->~Leaf();
+            leaf = next;
+        }
+        std::vector<std::pair<Inner*, std::size_t>> stack;
+        if (m_levels > 1) stack.emplace_back(static_cast<Inner*>(m_root), m_levels);
+        while (!stack.empty()) {
+            const auto top = stack.back();
+            stack.pop_back();
+            if (top.second > 2) {
+                for ( std::size_t i(0); i <= top.first->count; ++i )
+                    stack.emplace_back(static_cast<Inner*>(top.first->children[i]), top.second - 1);
+            }
+            top.first->~Inner();
+        }
+    }
+    m_leaves.clear();
+    m_inners.clear();
+    m_root = nullptr;
+    m_first = nullptr;
+    m_size = 0;
+    m_levels = 0;
+}
+
+template < typename T, std::size_t NodeBytes >
+auto BPlusTree<T, NodeBytes>::size() const -> std::size_t {
+    return m_size;
+}
+
+template < typename T, std::size_t NodeBytes >
+auto BPlusTree<T, NodeBytes>::empty() const -> bool {
+    return (0 == m_size);
+}
+
+template < typename T, std::size_t NodeBytes >
+auto BPlusTree<T, NodeBytes>::height() const -> std::size_t {
+    return m_levels;
+}
+
+template < typename T, std::size_t NodeBytes >
+auto BPlusTree<T, NodeBytes>::begin() const -> ConstIterator {
+    return ConstIterator(m_first, 0);
+}
+
+template < typename T, std::size_t NodeBytes >
+auto BPlusTree<T, NodeBytes>::end() const -> ConstIterator {
+    return ConstIterator();
+}
+
+template < typename T, std::size_t NodeBytes >
+auto BPlusTree<T, NodeBytes>::cbegin() const -> ConstIterator {
+    return begin();
+}
+
+template < typename T, std::size_t NodeBytes >
+auto BPlusTree<T, NodeBytes>::cend() const -> ConstIterator {
+    return end();
+}
+
+#endif
@@ -1,6 +1,18 @@
 /** @file BinaryTree.hpp
  *  @brief Class definition of a binary tree
  *
+ *  BALANCE_NONE keeps the plain binary search tree: keys inserted in
+ *  order make it a list. BALANCE_AVL rebalances the tree with
+ *  rotations after every insert and erase, its height stays below
+ *  1.45 * log2(n + 2) whatever the order of the keys.
+ *
+ *  Every node links to its parent, so nothing walks the tree with
+ *  recursion or a stack: insert and erase climb the parent links to
+ *  update heights (and rebalance) until a subtree keeps its height,
+ *  and the in-order, pre-order and post-order iterators step from a
+ *  node to the next one through its links. Heights are kept in both
+ *  modes, lenght() and size() are O(1).
+ *
  *  @author Massinissa Bandou
  *  @bug No known bugs.
  */
@@ -10,142 +22,688 @@
 /***********************************************************
  *                 std includes
 ***********************************************************/
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 /***********************************************************
  *               internal includes
 ***********************************************************/
-#include "../Misc/node.hpp" 
+#include "../Misc/node.hpp"
 #include "../Misc/constants.hpp"
+#include "../Misc/Exception.hpp"
+#include "FrozenBinaryTree.hpp"
 #include "LinkedList.hpp"
 
-template < typename T >
+/** @enum BALANCE_ENUM
+*   @brief how a binary tree keeps its height
+*/
+enum BALANCE_ENUM
+{
+    BALANCE_NONE = 0,
+    BALANCE_AVL
+}; // enum BALANCE_ENUM
+
+/** @enum TRAVERSAL_ENUM
+*   @brief order in which an iterator visits a binary tree
+*/
+enum TRAVERSAL_ENUM
+{
+    TRAVERSAL_IN_ORDER = 0,
+    TRAVERSAL_PRE_ORDER,
+    TRAVERSAL_POST_ORDER
+}; // enum TRAVERSAL_ENUM
+
+template < typename T, BALANCE_ENUM balance = BALANCE_NONE >
 /** @class BinaryTree
  *  @brief This class define a BinaryTree structure
  */
 class BinaryTree final {
 public:
+    template < TRAVERSAL_ENUM order >
+    /** @class TraversalIterator
+     *  @brief Iterator visiting the elements in the given order. Elements
+     *         are read-only, changing them would break the ordering. The
+     *         in-order iterator is bidirectional, --end() is the maximum.
+     */
+    class TraversalIterator final {
+    public:
+        using iterator_category = typename std::conditional<TRAVERSAL_IN_ORDER == order,
+                                                            std::bidirectional_iterator_tag,
+                                                            std::forward_iterator_tag>::type;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        TraversalIterator() = default;
+        auto operator*() const -> reference {
+            return m_node->data;
+        }
+        auto operator->() const -> pointer {
+            return &m_node->data;
+        }
+        auto operator++() -> TraversalIterator& {
+            m_node = (TRAVERSAL_IN_ORDER == order)  ? nextInOrder(m_node)  :
+                     (TRAVERSAL_PRE_ORDER == order) ? nextPreOrder(m_node) : nextPostOrder(m_node);
+            return *this;
+        }
+        auto operator++(int) -> TraversalIterator {
+            auto copy = *this;
+            ++(*this);
+            return copy;
+        }
+        auto operator--() -> TraversalIterator& {
+            static_assert(TRAVERSAL_IN_ORDER == order, "Only in-order iterators go backward");
+            m_node = (nullptr == m_node) ? rightmost(m_tree->root) : previousInOrder(m_node);
+            return *this;
+        }
+        auto operator--(int) -> TraversalIterator {
+            auto copy = *this;
+            --(*this);
+            return copy;
+        }
+        auto operator==( const TraversalIterator &other ) const -> bool {
+            return m_node == other.m_node;
+        }
+        auto operator!=( const TraversalIterator &other ) const -> bool {
+            return m_node != other.m_node;
+        }
+    private:
+        friend class BinaryTree;
+        const BinaryTree *m_tree {nullptr};
+        const TreeNode<T> *m_node {nullptr};
+
+        TraversalIterator( const BinaryTree *tree, const TreeNode<T> *node ) : m_tree(tree), m_node(node) {}
+    }; // class TraversalIterator
+    using ConstIterator = TraversalIterator<TRAVERSAL_IN_ORDER>;
+    using PreOrderIterator = TraversalIterator<TRAVERSAL_PRE_ORDER>;
+    using PostOrderIterator = TraversalIterator<TRAVERSAL_POST_ORDER>;
+    using const_iterator = ConstIterator;
+    using iterator = ConstIterator;
+    template < typename Iterator >
+    /** @class Range
+     *  @brief Pair of iterators usable in a range-based for loop
+     */
+    class Range final {
+    public:
+        Range( const Iterator &first, const Iterator &last ) : m_first(first), m_last(last) {}
+        auto begin() const -> Iterator {
+            return m_first;
+        }
+        auto end() const -> Iterator {
+            return m_last;
+        }
+    private:
+        Iterator m_first, m_last;
+    }; // class Range
     /***************************************************************************//**
     * @brief : Constructor
-    *           
+    *
     * @param : none
     ******************************************************************************/
     BinaryTree() = default;
     /***************************************************************************//**
     * @brief : Desctructor
-    *           
+    *
     * @param : none
     ******************************************************************************/
     ~BinaryTree();
     /***************************************************************************//**
     * @brief : Insert element to the binary tree
-    *           
+    *
     * @param in: data  - data of T type
     ******************************************************************************/
-    auto insert( const T data ) -> void;
+    auto insert( const T &data ) -> void;
+    /***************************************************************************//**
+    * @brief : Insert element to the binary tree, data is moved
+    *
+    * @param in: data  - T rvalue
+    ******************************************************************************/
+    auto insert( T &&data ) -> void;
+    /***************************************************************************//**
+    * @brief : Construct an element in place and insert it to the binary tree
+    *
+    * @param in: args  - arguments forwarded to the constructor of T
+    * @return  : Reference to the new element
+    ******************************************************************************/
+    template < typename... Args >
+    auto emplace( Args&&... args ) -> const T&;
+    /***************************************************************************//**
+    * @brief : Remove one element equal to data from the binary tree
+    *
+    * @param in : data  - data of T type
+    * @return   : false if no element is equal to data
+    ******************************************************************************/
+    auto erase( const T &data ) -> bool;
+    /***************************************************************************//**
+    * @brief : Remove the element at an iterator, iterators to the other
+    *          elements stay valid
+    *
+    * @param in : position - in-order iterator, not end()
+    * @return   : ConstIterator - element that followed the removed one
+    ******************************************************************************/
+    auto erase( const ConstIterator &position ) -> ConstIterator;
     /***************************************************************************//**
     * @brief : Find the Tree Node that contains data
-    *           
+    *
     * @param in : data  - data of T type
-    * @return   : TreeNode<T>* - pointer to the node that contains data 
+    * @return   : TreeNode<T>* - pointer to the node that contains data
+    ******************************************************************************/
+    auto find( const T &data ) -> TreeNode<T>*;
+    /***************************************************************************//**
+    * @brief : First element not lower than data, the ceiling of data
+    *
+    * @param in : data  - data of T type
+    * @return   : ConstIterator - element, end() if every element is lower
+    ******************************************************************************/
+    auto lower_bound( const T &data ) const -> ConstIterator;
+    /***************************************************************************//**
+    * @brief : First element greater than data, the one before it is the
+    *          floor of data
+    *
+    * @param in : data  - data of T type
+    * @return   : ConstIterator - element, end() if no element is greater
+    ******************************************************************************/
+    auto upper_bound( const T &data ) const -> ConstIterator;
+    /***************************************************************************//**
+    * @brief : Smallest element, throws when empty
+    *
+    * @param  : none
+    * @return : const T& - minimum
+    ******************************************************************************/
+    auto min() const -> const T&;
+    /***************************************************************************//**
+    * @brief : Largest element, throws when empty
+    *
+    * @param  : none
+    * @return : const T& - maximum
     ******************************************************************************/
-    auto find( const T data ) -> TreeNode<T>*;
+    auto max() const -> const T&;
     /***************************************************************************//**
     * @brief : Delete all elements of the binary tree
-    * 
+    *
     * @param - none
     ******************************************************************************/
     auto clear() -> void;
     /***************************************************************************//**
     * @brief : Get the lenght of the current tree
-    * 
+    *
     * @param  - none
     * @return - lenght of the binary tree
     ******************************************************************************/
     auto lenght() -> std::size_t;
+    /***************************************************************************//**
+    * @brief : Number of elements
+    *
+    * @param  : none
+    * @return : std::size_t - number of elements
+    ******************************************************************************/
+    auto size() const -> std::size_t;
+    /***************************************************************************//**
+    * @brief : Verify if the tree is empty
+    *
+    * @param  : none
+    * @return : Return true if size() is 0
+    ******************************************************************************/
+    auto empty() const -> bool;
+    /***************************************************************************//**
+    * @brief : Copy the elements into a read-only snapshot laid out for fast
+    *          lookups, later changes of the tree do not reach it
+    *
+    * @param  - none
+    * @return - FrozenBinaryTree<T> - snapshot of the elements
+    ******************************************************************************/
+    auto freeze() const -> FrozenBinaryTree<T>;
+    /***************************************************************************//**
+    * @brief : Elements in pre-order, a node before its subtrees
+    *
+    * @param  : none
+    * @return : Range - pre-order iterators
+    ******************************************************************************/
+    auto preOrder() const -> Range<PreOrderIterator>;
+    /***************************************************************************//**
+    * @brief : Elements in post-order, a node after its subtrees
+    *
+    * @param  : none
+    * @return : Range - post-order iterators
+    ******************************************************************************/
+    auto postOrder() const -> Range<PostOrderIterator>;
+    auto begin() const -> ConstIterator;
+    auto end() const -> ConstIterator;
+    auto cbegin() const -> ConstIterator;
+    auto cend() const -> ConstIterator;
 private:
     TreeNode<T> *root {nullptr};
+    std::size_t m_size {0};
+    NodePool<TreeNode<T>> m_pool;
+    /***************************************************************************//**
+    * @brief  : Link a new tree node to the binary tree
+    *
+    * @param in: node - TreeNode<T> without children
+    ******************************************************************************/
+    auto link( TreeNode<T> *node ) -> void;
+    /***************************************************************************//**
+    * @brief  : Unlink a node and free it, the smallest node of its right
+    *           subtree takes its place when it has two children
+    *
+    * @param in: node - node of the tree
+    ******************************************************************************/
+    auto unlink( TreeNode<T> *node ) -> void;
+    /***************************************************************************//**
+    * @brief  : Link of the parent, or root, pointing to a node
+    *
+    * @param in: node - node of the tree
+    * @return  : TreeNode<T>** - link to node
+    ******************************************************************************/
+    auto slotOf( TreeNode<T> *node ) -> TreeNode<T>**;
     /***************************************************************************//**
-    * @brief  : Insert element to the binary tree
-    *           
-    * @param in: data - const T
-    * @param in: node - TreeNode<T> reference to a pointer
+    * @brief  : Update the heights, and rebalance when balanced, from a node
+    *           up to the first subtree whose height did not change
+    *
+    * @param in: node - lowest node whose children changed, may be nullptr
     ******************************************************************************/
-    auto insert( const T data, TreeNode<T> **node ) -> void;
+    auto retrace( TreeNode<T> *node ) -> void;
     /***************************************************************************//**
-    * @brief  : Insert element to the binary tree
-    *           
-    * @param in: data - const T
-    * @param out: TreeNode<T> - reference to a pointer to node containing data 
+    * @brief  : Height of a subtree
+    *
+    * @param in: node - root of the subtree, may be nullptr
+    * @return  : height kept in the node, 0 for nullptr
     ******************************************************************************/
-    auto find( const T data, TreeNode<T> **node ) -> TreeNode<T>*;
+    static auto height( const TreeNode<T> *node ) -> std::int32_t;
     /***************************************************************************//**
-    * @brief  : Return the lenght of the binary tree
-    *           
-    * @param in: TreeNode<T> - reference to a pointer to node containing data 
-    * @return  : lenght of the binary tree
+    * @brief  : Recompute the height of a node from its children
+    *
+    * @param in: node - node whose children are up to date
     ******************************************************************************/
-    auto lenght( const TreeNode<T> *node ) -> std::size_t;
+    static auto update( TreeNode<T> *node ) -> void;
+    /***************************************************************************//**
+    * @brief  : Rotate a subtree, its left child becomes its root
+    *
+    * @param in: slot - link to the root of the subtree
+    ******************************************************************************/
+    static auto rotateRight( TreeNode<T> **slot ) -> void;
+    /***************************************************************************//**
+    * @brief  : Rotate a subtree, its right child becomes its root
+    *
+    * @param in: slot - link to the root of the subtree
+    ******************************************************************************/
+    static auto rotateLeft( TreeNode<T> **slot ) -> void;
+    /***************************************************************************//**
+    * @brief  : Update the height of a subtree and rotate it back within
+    *           the AVL bounds
+    *
+    * @param in: slot - link to the root of the subtree
+    ******************************************************************************/
+    static auto rebalance( TreeNode<T> **slot ) -> void;
+    /***************************************************************************//**
+    * @brief  : Smallest node, largest node and first post-order node of a
+    *           subtree
+    *
+    * @param in: node - root of the subtree, may be nullptr
+    * @return  : node, nullptr for an empty subtree
+    ******************************************************************************/
+    static auto leftmost( const TreeNode<T> *node ) -> const TreeNode<T>*;
+    static auto rightmost( const TreeNode<T> *node ) -> const TreeNode<T>*;
+    static auto deepestFirst( const TreeNode<T> *node ) -> const TreeNode<T>*;
+    /***************************************************************************//**
+    * @brief  : Node visited after, or before, a node in a traversal order
+    *
+    * @param in: node - node of the tree
+    * @return  : node, nullptr past the last one
+    ******************************************************************************/
+    static auto nextInOrder( const TreeNode<T> *node ) -> const TreeNode<T>*;
+    static auto previousInOrder( const TreeNode<T> *node ) -> const TreeNode<T>*;
+    static auto nextPreOrder( const TreeNode<T> *node ) -> const TreeNode<T>*;
+    static auto nextPostOrder( const TreeNode<T> *node ) -> const TreeNode<T>*;
 }; // class BinaryTree
 /***********************************************************
  *                Functions definition
 ************************************************************/
-template < typename T >
-BinaryTree<T>::~BinaryTree() {
+template < typename T, BALANCE_ENUM balance >
+BinaryTree<T, balance>::~BinaryTree() {
     clear();
 }
 
-template < typename T >
-auto BinaryTree<T>::insert( const T data ) -> void {
-    Insert(data, &root);
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::insert( const T &data ) -> void {
+    link(createNewTreeNode(m_pool, data));
+}
+
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::insert( T &&data ) -> void {
+    link(emplaceNewTreeNode(m_pool, std::move(data)));
+}
+
+template < typename T, BALANCE_ENUM balance >
+template < typename... Args >
+auto BinaryTree<T, balance>::emplace( Args&&... args ) -> const T& {
+    auto node = emplaceNewTreeNode(m_pool, std::forward<Args>(args)...);
+    link(node);
+    return node->data;
 }
 
-template < typename T >
-auto BinaryTree<T>::insert( const T data, TreeNode<T> **node ) -> void {
-    if (nullptr == *node) {
-        (*node) = createNewTreeNode(data);
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::link( TreeNode<T> *node ) -> void {
+    TreeNode<T> *parent = nullptr;
+    auto slot = &root;
+    while (nullptr != *slot) {
+        parent = *slot;
+        if (parent->data > node->data) {
+            slot = &(parent->left);
+        } else {
+            slot = &(parent->right);
+        }
+    }
+    node->parent = parent;
+    *slot = node;
+    m_size++;
+    retrace(parent);
+}
+
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::erase( const T &data ) -> bool {
+    auto node = find(data);
+    if (nullptr == node) return false;
+    unlink(node);
+    return true;
+}
+
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::erase( const ConstIterator &position ) -> ConstIterator {
+    auto next = position;
+    ++next;
+    // nodes are relinked, never copied, so next keeps its element
+    unlink(const_cast<TreeNode<T>*>(position.m_node));
+    return next;
+}
+
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::unlink( TreeNode<T> *node ) -> void {
+    auto slot = slotOf(node);
+    auto start = node->parent;
+    if (nullptr == node->left || nullptr == node->right) {
+        auto child = (nullptr == node->left) ? node->right : node->left;
+        if (nullptr != child) child->parent = node->parent;
+        *slot = child;
     } else {
-        if ((*node)->data > data) {
-            Insert(data, &((*node)->left)); 
+        auto next = node->right;
+        while (nullptr != next->left)
+            next = next->left;
+        if (next == node->right) {
+            start = next;
         } else {
-            Insert(data, &((*node)->right));
+            // next leaves its place to its right subtree
+            start = next->parent;
+            start->left = next->right;
+            if (nullptr != next->right) next->right->parent = start;
+            next->right = node->right;
+            node->right->parent = next;
         }
+        next->left = node->left;
+        node->left->parent = next;
+        next->parent = node->parent;
+        next->height = node->height;
+        *slot = next;
     }
+    m_pool.destroy(node);
+    m_size--;
+    retrace(start);
 }
 
-template < typename T >
-auto BinaryTree<T>::find( const T data ) -> TreeNode<T>* {
-    return find(data, &root);
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::slotOf( TreeNode<T> *node ) -> TreeNode<T>** {
+    auto parent = node->parent;
+    if (nullptr == parent) return &root;
+    return (parent->left == node) ? &(parent->left) : &(parent->right);
 }
 
-template < typename T >
-auto BinaryTree<T>::find( const T data, TreeNode<T> **node ) -> TreeNode<T>* {
-    if (nullptr != *node) {
-        if ((*node)->data == data) return *node;
-        if ((*node)->data > data)  return find(data, &((*node)->left));
-        else return find(data, &((*node)->right)); 
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::retrace( TreeNode<T> *node ) -> void {
+    while (nullptr != node) {
+        const auto before = node->height;
+        auto parent = node->parent;
+        auto slot = slotOf(node);
+        if (BALANCE_AVL == balance) rebalance(slot);
+        else update(node);
+        // the ancestors only depend on the height of the subtree
+        if ((*slot)->height == before) return;
+        node = parent;
     }
-    return nullptr;
 }
 
-template < typename T >
-auto BinaryTree<T>::clear() -> void {
-    removeTreeNode(root);
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::find( const T &data ) -> TreeNode<T>* {
+    auto node = root;
+    while (nullptr != node && !(node->data == data))
+        node = (node->data > data) ? node->left : node->right;
+    return node;
+}
+
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::lower_bound( const T &data ) const -> ConstIterator {
+    const TreeNode<T> *bound = nullptr;
+    for ( auto node = root; nullptr != node; ) {
+        if (data > node->data) {
+            node = node->right;
+        } else {
+            bound = node;
+            node = node->left;
+        }
+    }
+    return ConstIterator(this, bound);
+}
+
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::upper_bound( const T &data ) const -> ConstIterator {
+    const TreeNode<T> *bound = nullptr;
+    for ( auto node = root; nullptr != node; ) {
+        if (node->data > data) {
+            bound = node;
+            node = node->left;
+        } else {
+            node = node->right;
+        }
+    }
+    return ConstIterator(this, bound);
+}
+
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::min() const -> const T& {
+    if (nullptr == root)
+        throw Exception("Tree is empty");
+    return leftmost(root)->data;
+}
+
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::max() const -> const T& {
+    if (nullptr == root)
+        throw Exception("Tree is empty");
+    return rightmost(root)->data;
+}
+
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::clear() -> void {
+    removeTreeNode(m_pool, root);
+    root = nullptr;
+    m_size = 0;
+}
+
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::lenght() -> std::size_t {
+    return static_cast<std::size_t>(height(root));
+}
+
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::size() const -> std::size_t {
+    return m_size;
+}
+
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::empty() const -> bool {
+    return (0 == m_size);
+}
+
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::freeze() const -> FrozenBinaryTree<T> {
+    std::vector<T> sorted;
+    sorted.reserve(m_size);
+    for ( const auto &data : *this )
+        sorted.push_back(data);
+    return FrozenBinaryTree<T>(sorted);
+}
+
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::preOrder() const -> Range<PreOrderIterator> {
+    return Range<PreOrderIterator>(PreOrderIterator(this, root), PreOrderIterator(this, nullptr));
+}
+
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::postOrder() const -> Range<PostOrderIterator> {
+    return Range<PostOrderIterator>(PostOrderIterator(this, deepestFirst(root)), PostOrderIterator(this, nullptr));
+}
+
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::begin() const -> ConstIterator {
+    return ConstIterator(this, leftmost(root));
+}
+
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::end() const -> ConstIterator {
+    return ConstIterator(this, nullptr);
+}
+
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::cbegin() const -> ConstIterator {
+    return begin();
+}
+
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::cend() const -> ConstIterator {
+    return end();
+}
+
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::height( const TreeNode<T> *node ) -> std::int32_t {
+    return (nullptr == node) ? 0 : node->height;
+}
+
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::update( TreeNode<T> *node ) -> void {
+    const auto left = height(node->left), right = height(node->right);
+    node->height = 1 + ((left > right) ? left : right);
+}
+
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::rotateRight( TreeNode<T> **slot ) -> void {
+    auto node = *slot, left = node->left;
+    node->left = left->right;
+    if (nullptr != left->right) left->right->parent = node;
+    left->right = node;
+    left->parent = node->parent;
+    node->parent = left;
+    update(node);
+    update(left);
+    *slot = left;
+}
+
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::rotateLeft( TreeNode<T> **slot ) -> void {
+    auto node = *slot, right = node->right;
+    node->right = right->left;
+    if (nullptr != right->left) right->left->parent = node;
+    right->left = node;
+    right->parent = node->parent;
+    node->parent = right;
+    update(node);
+    update(right);
+    *slot = right;
 }
 
-template < typename T >
-auto BinaryTree<T>::lenght() -> std::size_t {
-    return lenght(root);
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::rebalance( TreeNode<T> **slot ) -> void {
+    auto node = *slot;
+    update(node);
+    const auto factor = height(node->left) - height(node->right);
+    if (factor > 1) {
+        if (height(node->left->left) < height(node->left->right))
+            rotateLeft(&(node->left));
+        rotateRight(slot);
+    } else if (factor < -1) {
+        if (height(node->right->right) < height(node->right->left))
+            rotateRight(&(node->right));
+        rotateLeft(slot);
+    }
 }
 
-template < typename T >
-auto BinaryTree<T>::lenght( const TreeNode<T> *node ) -> std::size_t {
-    int l = 0, r = 0;
-    if ( nullptr != node ) {
-        l = 1 + lenght(node->left);
-        r = 1 + lenght(node->right);
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::leftmost( const TreeNode<T> *node ) -> const TreeNode<T>* {
+    if (nullptr != node) {
+        while (nullptr != node->left)
+            node = node->left;
     }
-    return (l > r) ? l : r;
+    return node;
+}
+
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::rightmost( const TreeNode<T> *node ) -> const TreeNode<T>* {
+    if (nullptr != node) {
+        while (nullptr != node->right)
+            node = node->right;
+    }
+    return node;
+}
+
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::deepestFirst( const TreeNode<T> *node ) -> const TreeNode<T>* {
+    // a post-order walk starts at the leaf reached going left whenever possible
+    while (nullptr != node) {
+        if (nullptr != node->left) node = node->left;
+        else if (nullptr != node->right) node = node->right;
+        else break;
+    }
+    return node;
+}
+
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::nextInOrder( const TreeNode<T> *node ) -> const TreeNode<T>* {
+    if (nullptr != node->right) return leftmost(node->right);
+    while (nullptr != node->parent && node->parent->right == node)
+        node = node->parent;
+    return node->parent;
+}
+
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::previousInOrder( const TreeNode<T> *node ) -> const TreeNode<T>* {
+    if (nullptr != node->left) return rightmost(node->left);
+    while (nullptr != node->parent && node->parent->left == node)
+        node = node->parent;
+    return node->parent;
+}
+
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::nextPreOrder( const TreeNode<T> *node ) -> const TreeNode<T>* {
+    if (nullptr != node->left) return node->left;
+    if (nullptr != node->right) return node->right;
+    // climb to the first ancestor whose right subtree is still to visit
+    while (nullptr != node->parent) {
+        auto parent = node->parent;
+        if (parent->left == node && nullptr != parent->right) return parent->right;
+        node = parent;
+    }
+    return nullptr;
+}
+
+template < typename T, BALANCE_ENUM balance >
+auto BinaryTree<T, balance>::nextPostOrder( const TreeNode<T> *node ) -> const TreeNode<T>* {
+    auto parent = node->parent;
+    if (nullptr == parent) return nullptr;
+    if (parent->left == node && nullptr != parent->right) return deepestFirst(parent->right);
+    return parent;
 }
 
 #endif
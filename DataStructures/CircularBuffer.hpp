@@ -1,8 +1,23 @@
 /** @file CircularBuffer.hpp
  *  @brief Class definition of a circular buffer
  * 
- *  CircularBuffer class uses a linked list to
- *  define a buffer of a fixed size.
+ *  CircularBuffer class uses a linked list or a fixed
+ *  array to define a buffer of a fixed size. A single
+ *  producer thread handing elements to a single consumer
+ *  thread should use SpscCircularBuffer instead, many
+ *  producers and consumers MpmcCircularBuffer and
+ *  processes exchanging bytes SharedCircularBuffer. A
+ *  capacity known only at runtime is the job of
+ *  DynamicCircularBuffer.
+ * 
+ *  What a put does to a full buffer is a template parameter:
+ *  overwrite the oldest element, reject the new one or block until
+ *  a consumer makes room. Only a blocking buffer is synchronized,
+ *  with a mutex and a condition variable, the others take no lock.
+ *  The buffer counts puts, overwritten, rejected and blocked
+ *  elements, its high-water mark and an occupancy histogram. The
+ *  counters are relaxed atomics with a single writer at a time,
+ *  stats() reads them from any thread.
  * 
  *  @author Massinissa Bandou
  *  @bug No known bugs.
@@ -13,43 +28,148 @@
 /***********************************************************
  *                   std includes
 ***********************************************************/
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
 #include <iostream>
+#include <mutex>
+#include <type_traits>
+#include <utility>
 
 /***********************************************************
  *                 internal includes
 ***********************************************************/
-#include "LinkedList.hpp"
+#include "CircularBufferStorage.hpp"
+#include "../Misc/constants.hpp"
+
+/** @enum OVERFLOW_ENUM
+*   @brief what a put does when the circular buffer is full
+*/
+enum OVERFLOW_ENUM
+{
+    OVERFLOW_OVERWRITE_OLDEST = 0,
+    OVERFLOW_REJECT_NEWEST,
+    OVERFLOW_BLOCK
+}; // enum OVERFLOW_ENUM
+
+/** @struct CircularBufferStats
+ *  @brief Snapshot of the counters of a circular buffer
+ */
+struct CircularBufferStats {
+    std::uint64_t puts;         // elements offered to put and emplace
+    std::uint64_t overwritten;  // oldest elements dropped to make room
+    std::uint64_t rejected;     // new elements refused
+    std::uint64_t blocked;      // puts that waited for room
+    std::uint64_t highWater;    // largest count() seen after a put
+    // puts by count() after the put, bucket i holds the counts in
+    // (i * size / OCCUPANCY_HISTOGRAM_BUCKETS, (i + 1) * size / OCCUPANCY_HISTOGRAM_BUCKETS]
+    std::uint64_t occupancy[OCCUPANCY_HISTOGRAM_BUCKETS];
+}; // struct CircularBufferStats
+
+/** @struct CircularBufferNoLock
+ *  @brief Mutex and condition variable of the buffers that never block,
+ *         every call does nothing
+ */
+struct CircularBufferNoLock {
+    auto lock() -> void {}
+    auto unlock() -> void {}
+    auto notify_all() -> void {}
+    template < typename Lock, typename Predicate >
+    auto wait( Lock &, Predicate ) -> void {}
+}; // struct CircularBufferNoLock
 
-template < typename T , std::size_t size >
+template < typename T , std::size_t size, STORAGE_ENUM storage = STORAGE_LINKED_LIST,
+           OVERFLOW_ENUM policy = OVERFLOW_OVERWRITE_OLDEST >
 /** @class CircularBuffer
- *  @brief This class define a circular buffer of a fixed size
+ *  @brief This class define a circular buffer of a fixed size. Once
+ *         full, a put follows the overflow policy of the buffer. Only
+ *         OVERFLOW_BLOCK buffers may be shared between threads.
  */
 class CircularBuffer final {
+    static_assert(size > 0, "A circular buffer holds at least one element");
+    using Mutex = typename std::conditional<OVERFLOW_BLOCK == policy, std::mutex,
+                                            CircularBufferNoLock>::type;
+    using Condition = typename std::conditional<OVERFLOW_BLOCK == policy, std::condition_variable,
+                                                CircularBufferNoLock>::type;
 public:
     /***************************************************************************//**
     * @brief : Constructor
     *           
     * @param : none
     ******************************************************************************/
-    CircularBuffer() = default;
+    CircularBuffer();
     /***************************************************************************//**
     * @brief : Destructor
     * 
     * @param : none
     ******************************************************************************/
     ~CircularBuffer() = default;
+    CircularBuffer( const CircularBuffer & ) = delete;
+    auto operator=( const CircularBuffer & ) -> CircularBuffer& = delete;
     /***************************************************************************//**
     * @brief : add an element to buffer
     *           
     * @param in : input - const T 
+    * @return   : false if the buffer is full and rejects new elements
+    ******************************************************************************/
+    auto put( const T &input ) -> bool;
+    /***************************************************************************//**
+    * @brief : add an element to buffer, input is moved
+    *           
+    * @param in : input - T rvalue, left untouched when rejected
+    * @return   : false if the buffer is full and rejects new elements
+    ******************************************************************************/
+    auto put( T &&input ) -> bool;
+    /***************************************************************************//**
+    * @brief : construct an element in place at the end of the buffer
+    *           
+    * @param in : args - arguments forwarded to the constructor of T
+    * @return   : false if the buffer is full and rejects new elements
+    ******************************************************************************/
+    template < typename... Args >
+    auto emplace( Args&&... args ) -> bool;
+    /***************************************************************************//**
+    * @brief : add a block of elements to buffer. With array storage and
+    *          trivially copyable T the block is copied with at most two
+    *          memcpy per run that fits.
+    *           
+    * @param in : input - first of count contiguous elements
+    * @param in : count - number of elements. When overwriting only the last
+    *                     size are kept, when rejecting only those that fit
+    *                     are stored and when blocking every element is
+    *                     stored as room is made.
+    * @return   : std::size_t - number of elements accepted
+    ******************************************************************************/
+    auto put( const T *input, std::size_t count ) -> std::size_t;
+    /***************************************************************************//**
+    * @brief : remove the oldest elements of the buffer
+    *           
+    * @param out : output - receives up to count contiguous elements
+    * @param in  : count  - maximum number of elements
+    * @return    : std::size_t - number of elements removed
+    ******************************************************************************/
+    auto get( T *output, const std::size_t count ) -> std::size_t;
+    /***************************************************************************//**
+    * @brief : copy the oldest elements of the buffer without removing them
+    *           
+    * @param out : output - receives up to count contiguous elements
+    * @param in  : count  - maximum number of elements
+    * @return    : std::size_t - number of elements copied
+    ******************************************************************************/
+    auto peek( T *output, const std::size_t count ) -> std::size_t;
+    /***************************************************************************//**
+    * @brief : remove the oldest element of the buffer
+    *           
+    * @param  : none
+    * @return : false if the buffer is empty
     ******************************************************************************/
-    auto put( const T input ) -> void;
+    auto popFront() -> bool;
     /***************************************************************************//**
     * @brief : Remove an element to buffer
     *           
     * @param in : input - const T 
     ******************************************************************************/
-    auto remove( const T input ) -> void;
+    auto remove( const T &input ) -> void;
     /***************************************************************************//**
     * @brief : Remove all elements in current buffer
     *           
@@ -64,48 +184,277 @@ public:
     ******************************************************************************/
     auto empty() -> bool;
     /***************************************************************************//**
-    * @brief : Index operator
+    * @brief : Number of elements in current buffer
+    *           
+    * @param  : none
+    * @return : std::size_t - number of elements, at most size
+    ******************************************************************************/
+    auto count() -> std::size_t;
+    /***************************************************************************//**
+    * @brief : Index operator, not synchronized: the reference outlives any
+    *          lock, a blocking buffer shared between threads is read with
+    *          peek or get
     * 
     * @param in:  index position
     * @return  :  Reference to data at position index  
     ******************************************************************************/
     auto operator[] ( const std::size_t index ) -> T&;
+    /***************************************************************************//**
+    * @brief : Overflow policy of the buffer
+    *           
+    * @param  : none
+    * @return : OVERFLOW_ENUM - policy given as template parameter
+    ******************************************************************************/
+    auto overflow() const -> OVERFLOW_ENUM;
+    /***************************************************************************//**
+    * @brief : Read the counters, each one is exact but they are not read
+    *          at the same instant while producers run
+    *           
+    * @param  : none
+    * @return : CircularBufferStats - snapshot of the counters
+    ******************************************************************************/
+    auto stats() const -> CircularBufferStats;
+    /***************************************************************************//**
+    * @brief : Set every counter back to 0
+    *           
+    * @param : none
+    ******************************************************************************/
+    auto resetStats() -> void;
 private:
-    LinkedList<T> m_linkedList;
+    CircularBufferStorage<T, size, storage> m_storage;
+    Mutex m_mutex;
+    Condition m_notFull;
+    std::atomic<std::uint64_t> m_puts {0},
+                               m_overwritten {0},
+                               m_rejected {0},
+                               m_blocked {0},
+                               m_highWater {0};
+    std::atomic<std::uint64_t> m_occupancy[OCCUPANCY_HISTOGRAM_BUCKETS];
+    /***************************************************************************//**
+    * @brief : Make room for new elements according to the overflow policy,
+    *          the lock of a blocking buffer is held
+    *           
+    * @param in : lock   - lock of m_mutex, released while blocking
+    * @param in : wanted - number of elements to store
+    * @return   : std::size_t - number of elements that now fit, at most
+    *             wanted, 0 only when rejecting
+    ******************************************************************************/
+    auto makeRoom( std::unique_lock<Mutex> &lock, const std::size_t wanted ) -> std::size_t;
+    /***************************************************************************//**
+    * @brief : Record the occupancy after a put, the lock of a blocking
+    *          buffer is held
+    *           
+    * @param : none
+    ******************************************************************************/
+    auto sample() -> void;
+    /***************************************************************************//**
+    * @brief : Add to a counter. There is one writer at a time, the owner
+    *          of an unsynchronized buffer or the holder of the lock, so a
+    *          relaxed load and store replace the locked read-modify-write.
+    *           
+    * @param in : counter - counter to increase
+    * @param in : value   - amount to add
+    ******************************************************************************/
+    static auto bump( std::atomic<std::uint64_t> &counter, const std::uint64_t value ) -> void;
 }; // class CircularBuffer
 /***********************************************************
  *                Functions definition
 ************************************************************/
-template < typename T, std::size_t size >
-auto CircularBuffer<T, size>::put( const T input ) -> void {
-    if (m_linkedList.size() == size) {
-        m_linkedList.popFront();
+template < typename T, std::size_t size, STORAGE_ENUM storage, OVERFLOW_ENUM policy >
+CircularBuffer<T, size, storage, policy>::CircularBuffer() {
+    for ( auto &bucket : m_occupancy )
+        bucket.store(0, std::memory_order_relaxed);
+}
+
+template < typename T, std::size_t size, STORAGE_ENUM storage, OVERFLOW_ENUM policy >
+auto CircularBuffer<T, size, storage, policy>::put( const T &input ) -> bool {
+    return emplace(input);
+}
+
+template < typename T, std::size_t size, STORAGE_ENUM storage, OVERFLOW_ENUM policy >
+auto CircularBuffer<T, size, storage, policy>::put( T &&input ) -> bool {
+    return emplace(std::move(input));
+}
+
+template < typename T, std::size_t size, STORAGE_ENUM storage, OVERFLOW_ENUM policy >
+template < typename... Args >
+auto CircularBuffer<T, size, storage, policy>::emplace( Args&&... args ) -> bool {
+    std::unique_lock<Mutex> lock(m_mutex);
+    bump(m_puts, 1);
+    if (OVERFLOW_OVERWRITE_OLDEST == policy && size == m_storage.count()) {
+        // args may refer to the oldest element, like put((*this)[0]), build
+        // the new element before dropping it
+        T value(std::forward<Args>(args)...);
+        makeRoom(lock, 1);
+        m_storage.pushBack(std::move(value));
+    } else {
+        if (0 == makeRoom(lock, 1)) return false;
+        m_storage.pushBack(std::forward<Args>(args)...);
     }
-    m_linkedList.add(input);
+    sample();
+    return true;
 }
 
-template < typename T, std::size_t size >
-auto CircularBuffer<T, size>::remove( const T input ) -> void {
-    m_linkedList.remove(input);
+template < typename T, std::size_t size, STORAGE_ENUM storage, OVERFLOW_ENUM policy >
+auto CircularBuffer<T, size, storage, policy>::put( const T *input, std::size_t count ) -> std::size_t {
+    std::unique_lock<Mutex> lock(m_mutex);
+    bump(m_puts, count);
+    std::size_t accepted(0);
+    if (OVERFLOW_OVERWRITE_OLDEST == policy && count > size) {
+        // the head of the block would be overwritten by its own tail
+        bump(m_overwritten, count - size);
+        accepted = count - size;
+    }
+    while (accepted < count) {
+        const auto room = makeRoom(lock, count - accepted);
+        if (0 == room) break;
+        m_storage.pushBack(input + accepted, room);
+        accepted += room;
+        sample();
+        // rejecting counted every element that did not fit
+        if (OVERFLOW_REJECT_NEWEST == policy) break;
+    }
+    return accepted;
 }
 
-template < typename T, std::size_t size >
-auto CircularBuffer<T, size>::removeAll() -> void {
-    m_linkedList.clear();
+template < typename T, std::size_t size, STORAGE_ENUM storage, OVERFLOW_ENUM policy >
+auto CircularBuffer<T, size, storage, policy>::get( T *output, const std::size_t count ) -> std::size_t {
+    std::size_t removed(0);
+    {
+        std::lock_guard<Mutex> lock(m_mutex);
+        const auto stored = m_storage.count();
+        removed = (count < stored) ? count : stored;
+        m_storage.front(output, removed, true);
+        m_storage.discard(removed);
+    }
+    if (0 != removed) m_notFull.notify_all();
+    return removed;
 }
 
-template < typename T, std::size_t size >
-auto CircularBuffer<T, size>::empty() -> bool {
-    return m_linkedList.empty();
+template < typename T, std::size_t size, STORAGE_ENUM storage, OVERFLOW_ENUM policy >
+auto CircularBuffer<T, size, storage, policy>::peek( T *output, const std::size_t count ) -> std::size_t {
+    std::lock_guard<Mutex> lock(m_mutex);
+    const auto stored = m_storage.count();
+    const auto copied = (count < stored) ? count : stored;
+    m_storage.front(output, copied, false);
+    return copied;
+}
+
+template < typename T, std::size_t size, STORAGE_ENUM storage, OVERFLOW_ENUM policy >
+auto CircularBuffer<T, size, storage, policy>::popFront() -> bool {
+    {
+        std::lock_guard<Mutex> lock(m_mutex);
+        if (0 == m_storage.count()) return false;
+        m_storage.discard(1);
+    }
+    m_notFull.notify_all();
+    return true;
+}
+
+template < typename T, std::size_t size, STORAGE_ENUM storage, OVERFLOW_ENUM policy >
+auto CircularBuffer<T, size, storage, policy>::remove( const T &input ) -> void {
+    {
+        std::lock_guard<Mutex> lock(m_mutex);
+        m_storage.remove(input);
+    }
+    m_notFull.notify_all();
 }
 
-template < typename T, std::size_t size >
-auto CircularBuffer<T, size>::operator[] ( const std::size_t index ) -> T& {
-    try {
-        return m_linkedList[index];
-    } catch (...) {
-        throw;
+template < typename T, std::size_t size, STORAGE_ENUM storage, OVERFLOW_ENUM policy >
+auto CircularBuffer<T, size, storage, policy>::removeAll() -> void {
+    {
+        std::lock_guard<Mutex> lock(m_mutex);
+        m_storage.clear();
     }
+    m_notFull.notify_all();
+}
+
+template < typename T, std::size_t size, STORAGE_ENUM storage, OVERFLOW_ENUM policy >
+auto CircularBuffer<T, size, storage, policy>::empty() -> bool {
+    std::lock_guard<Mutex> lock(m_mutex);
+    return (0 == m_storage.count());
+}
+
+template < typename T, std::size_t size, STORAGE_ENUM storage, OVERFLOW_ENUM policy >
+auto CircularBuffer<T, size, storage, policy>::count() -> std::size_t {
+    std::lock_guard<Mutex> lock(m_mutex);
+    return m_storage.count();
+}
+
+template < typename T, std::size_t size, STORAGE_ENUM storage, OVERFLOW_ENUM policy >
+auto CircularBuffer<T, size, storage, policy>::operator[] ( const std::size_t index ) -> T& {
+    return m_storage.at(index);
+}
+
+template < typename T, std::size_t size, STORAGE_ENUM storage, OVERFLOW_ENUM policy >
+auto CircularBuffer<T, size, storage, policy>::overflow() const -> OVERFLOW_ENUM {
+    return policy;
+}
+
+template < typename T, std::size_t size, STORAGE_ENUM storage, OVERFLOW_ENUM policy >
+auto CircularBuffer<T, size, storage, policy>::stats() const -> CircularBufferStats {
+    CircularBufferStats stats;
+    stats.puts = m_puts.load(std::memory_order_relaxed);
+    stats.overwritten = m_overwritten.load(std::memory_order_relaxed);
+    stats.rejected = m_rejected.load(std::memory_order_relaxed);
+    stats.blocked = m_blocked.load(std::memory_order_relaxed);
+    stats.highWater = m_highWater.load(std::memory_order_relaxed);
+    for ( std::size_t i(0); i < OCCUPANCY_HISTOGRAM_BUCKETS; ++i )
+        stats.occupancy[i] = m_occupancy[i].load(std::memory_order_relaxed);
+    return stats;
+}
+
+template < typename T, std::size_t size, STORAGE_ENUM storage, OVERFLOW_ENUM policy >
+auto CircularBuffer<T, size, storage, policy>::resetStats() -> void {
+    std::lock_guard<Mutex> lock(m_mutex);
+    m_puts.store(0, std::memory_order_relaxed);
+    m_overwritten.store(0, std::memory_order_relaxed);
+    m_rejected.store(0, std::memory_order_relaxed);
+    m_blocked.store(0, std::memory_order_relaxed);
+    m_highWater.store(0, std::memory_order_relaxed);
+    for ( auto &bucket : m_occupancy )
+        bucket.store(0, std::memory_order_relaxed);
+}
+
+template < typename T, std::size_t size, STORAGE_ENUM storage, OVERFLOW_ENUM policy >
+auto CircularBuffer<T, size, storage, policy>::makeRoom( std::unique_lock<Mutex> &lock, const std::size_t wanted ) -> std::size_t {
+    auto free = size - m_storage.count();
+    switch (policy) {
+    case OVERFLOW_OVERWRITE_OLDEST: {
+        const auto room = (wanted < size) ? wanted : size;
+        if (room > free) {
+            m_storage.discard(room - free);
+            bump(m_overwritten, room - free);
+        }
+        return room;
+    }
+    case OVERFLOW_REJECT_NEWEST: {
+        const auto room = (wanted < free) ? wanted : free;
+        bump(m_rejected, wanted - room);
+        return room;
+    }
+    case OVERFLOW_BLOCK:
+    default:
+        if (0 == free) {
+            bump(m_blocked, 1);
+            m_notFull.wait(lock, [this] { return m_storage.count() < size; });
+            free = size - m_storage.count();
+        }
+        return (wanted < free) ? wanted : free;
+    }
+}
+
+template < typename T, std::size_t size, STORAGE_ENUM storage, OVERFLOW_ENUM policy >
+auto CircularBuffer<T, size, storage, policy>::sample() -> void {
+    const auto occupancy = m_storage.count();
+    if (occupancy > m_highWater.load(std::memory_order_relaxed))
+        m_highWater.store(occupancy, std::memory_order_relaxed);
+    bump(m_occupancy[(occupancy * OCCUPANCY_HISTOGRAM_BUCKETS + size - 1) / size - 1], 1);
+}
+
+template < typename T, std::size_t size, STORAGE_ENUM storage, OVERFLOW_ENUM policy >
+auto CircularBuffer<T, size, storage, policy>::bump( std::atomic<std::uint64_t> &counter, const std::uint64_t value ) -> void {
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
 }
 
 #endif
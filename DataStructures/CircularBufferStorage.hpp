@@ -0,0 +1,243 @@
+/** @file CircularBufferStorage.hpp
+ *  @brief Storage backends of CircularBuffer
+ *
+ *  STORAGE_LINKED_LIST keeps the elements in an indexed LinkedList.
+ *  STORAGE_ARRAY keeps them in a std::array used as a ring: put never
+ *  allocates and operator[] is a single load, slots are found with a
+ *  mask when size is a power of two.
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+#ifndef CIRCULARBUFFERSTORAGE_HPP_
+#define CIRCULARBUFFERSTORAGE_HPP_
+
+/***********************************************************
+ *                   std includes
+***********************************************************/
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+/***********************************************************
+ *                 internal includes
+***********************************************************/
+#include "LinkedList.hpp"
+#include "../Misc/Exception.hpp"
+
+/** @enum STORAGE_ENUM
+*   @brief storage used by a circular buffer
+*/
+enum STORAGE_ENUM
+{
+    STORAGE_LINKED_LIST = 0,
+    STORAGE_ARRAY
+}; // enum STORAGE_ENUM
+
+template < typename T, std::size_t size, STORAGE_ENUM storage >
+/** @class CircularBufferStorage
+ *  @brief Elements of a circular buffer, oldest first. The buffer
+ *         pops the front before pushing when count() reaches size.
+ */
+class CircularBufferStorage;
+
+template < typename T, std::size_t size >
+/** @class CircularBufferStorage
+ *  @brief Linked list storage, operator[] runs in O(log n)
+ */
+class CircularBufferStorage<T, size, STORAGE_LINKED_LIST> final {
+public:
+    /***************************************************************************//**
+    * @brief : Constructor, indexes the underlying list
+    *
+    * @param : none
+    ******************************************************************************/
+    CircularBufferStorage() {
+        m_linkedList.enableIndex();
+    }
+    /***************************************************************************//**
+    * @brief : Construct an element after the newest one, count() < size
+    *
+    * @param in : args - arguments forwarded to the constructor of T
+    * @return   : Reference to the new element
+    ******************************************************************************/
+    template < typename... Args >
+    auto pushBack( Args&&... args ) -> T& {
+        return m_linkedList.emplace_back(std::forward<Args>(args)...);
+    }
+    auto popFront() -> void {
+        m_linkedList.popFront();
+    }
+    /***************************************************************************//**
+    * @brief : Append count elements, count() + count <= size
+    *
+    * @param in : input - first of count contiguous elements
+    * @param in : count - number of elements
+    ******************************************************************************/
+    auto pushBack( const T *input, const std::size_t count ) -> void {
+        m_linkedList.addRange(input, input + count);
+    }
+    /***************************************************************************//**
+    * @brief : Remove the count oldest elements, count <= count()
+    *
+    * @param in : count - number of elements
+    ******************************************************************************/
+    auto discard( const std::size_t count ) -> void {
+        m_linkedList.popFront(count);
+    }
+    /***************************************************************************//**
+    * @brief : Copy or move the count oldest elements, count <= count()
+    *
+    * @param out: output - first of count contiguous elements
+    * @param in : count  - number of elements
+    * @param in : take   - move the elements out instead of copying them
+    ******************************************************************************/
+    auto front( T *output, const std::size_t count, const bool take ) -> void {
+        auto itr = m_linkedList.begin();
+        for ( std::size_t i(0); i < count; ++i, ++itr )
+            output[i] = take ? std::move(*itr) : *itr;
+    }
+    auto remove( const T &input ) -> void {
+        m_linkedList.remove(input);
+    }
+    auto clear() -> void {
+        m_linkedList.clear();
+    }
+    auto count() const -> std::size_t {
+        return m_linkedList.size();
+    }
+    auto at( const std::size_t index ) -> T& {
+        return m_linkedList[index];
+    }
+private:
+    LinkedList<T> m_linkedList;
+}; // class CircularBufferStorage
+
+template < typename T, std::size_t size >
+/** @class CircularBufferStorage
+ *  @brief Array storage, T must be default constructible and move
+ *         assignable. Not synchronized, never allocates.
+ */
+class CircularBufferStorage<T, size, STORAGE_ARRAY> final {
+    static_assert(size > 0, "A circular buffer holds at least one element");
+public:
+    /***************************************************************************//**
+    * @brief : Construct an element after the newest one, count() < size
+    *
+    * @param in : args - arguments forwarded to the constructor of T
+    * @return   : Reference to the new element
+    ******************************************************************************/
+    template < typename... Args >
+    auto pushBack( Args&&... args ) -> T& {
+        auto &slot = m_items[wrap(m_head + m_count)];
+        slot = T(std::forward<Args>(args)...);
+        m_count++;
+        return slot;
+    }
+    auto popFront() -> void {
+        if (0 == m_count) return;
+        release(m_items[m_head]);
+        m_head = wrap(m_head + 1);
+        m_count--;
+    }
+    auto pushBack( const T *input, const std::size_t count ) -> void {
+        // at most two contiguous runs, before and after the wrap point
+        const auto start = wrap(m_head + m_count);
+        const auto first = (count < size - start) ? count : size - start;
+        copy(&m_items[start], input, first, Trivial());
+        copy(&m_items[0], input + first, count - first, Trivial());
+        m_count += count;
+    }
+    auto discard( const std::size_t count ) -> void {
+        if (std::is_trivially_destructible<T>::value) {
+            m_head = wrap(m_head + count);
+            m_count -= count;
+        } else {
+            for ( std::size_t i(0); i < count; ++i )
+                popFront();
+        }
+    }
+    auto front( T *output, const std::size_t count, const bool take ) -> void {
+        const auto first = (count < size - m_head) ? count : size - m_head;
+        if (take) {
+            move(output, &m_items[m_head], first, Trivial());
+            move(output + first, &m_items[0], count - first, Trivial());
+        } else {
+            copy(output, &m_items[m_head], first, Trivial());
+            copy(output + first, &m_items[0], count - first, Trivial());
+        }
+    }
+    auto remove( const T &input ) -> void {
+        for ( std::size_t i(0); i < m_count; ++i ) {
+            if (m_items[wrap(m_head + i)] == input) {
+                for ( auto j = i; j + 1 < m_count; ++j )
+                    m_items[wrap(m_head + j)] = std::move(m_items[wrap(m_head + j + 1)]);
+                release(m_items[wrap(m_head + m_count - 1)]);
+                m_count--;
+                return;
+            }
+        }
+    }
+    auto clear() -> void {
+        while (0 != m_count)
+            popFront();
+        m_head = 0;
+    }
+    auto count() const -> std::size_t {
+        return m_count;
+    }
+    auto at( const std::size_t index ) -> T& {
+        if (index >= m_count)
+            throw Exception("Index out of range");
+        return m_items[wrap(m_head + index)];
+    }
+private:
+    static constexpr bool POWER_OF_TWO = (0 == (size & (size - 1)));
+    using Trivial = std::integral_constant<bool, std::is_trivially_copyable<T>::value>;
+    std::array<T, size> m_items {};
+    std::size_t m_head {0},
+                m_count {0};
+    /***************************************************************************//**
+    * @brief : Slot of a position in [0, 2 * size)
+    *
+    * @param in : position - head plus an offset lower than size
+    * @return   : slot index in [0, size)
+    ******************************************************************************/
+    static auto wrap( const std::size_t position ) -> std::size_t {
+        return POWER_OF_TWO ? (position & (size - 1))
+                            : ((position >= size) ? position - size : position);
+    }
+    /***************************************************************************//**
+    * @brief : Release the resources of a vacated slot
+    *
+    * @param in : item - slot no longer part of the buffer
+    ******************************************************************************/
+    static auto release( T &item ) -> void {
+        if (!std::is_trivially_destructible<T>::value) item = T();
+    }
+    /***************************************************************************//**
+    * @brief : Copy or move a run of count elements, with a single memcpy
+    *          when T is trivially copyable
+    *
+    * @param out: dest  - first destination element
+    * @param in : src   - first source element
+    * @param in : count - number of elements
+    ******************************************************************************/
+    static auto copy( T *dest, const T *src, const std::size_t count, std::true_type ) -> void {
+        if (0 != count) std::memcpy(dest, src, count * sizeof(T));
+    }
+    static auto copy( T *dest, const T *src, const std::size_t count, std::false_type ) -> void {
+        std::copy(src, src + count, dest);
+    }
+    static auto move( T *dest, T *src, const std::size_t count, std::true_type ) -> void {
+        if (0 != count) std::memcpy(dest, src, count * sizeof(T));
+    }
+    static auto move( T *dest, T *src, const std::size_t count, std::false_type ) -> void {
+        std::move(src, src + count, dest);
+    }
+}; // class CircularBufferStorage
+
+#endif
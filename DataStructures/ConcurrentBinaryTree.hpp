@@ -0,0 +1,520 @@
+/** @file ConcurrentBinaryTree.hpp
+ *  @brief Class definition of a binary tree with lock-free lookups
+ *
+ *  ConcurrentBinaryTree is an AVL tree whose published nodes are never
+ *  modified. A writer copies the nodes on the path it changes (and
+ *  the few a rotation moves), builds the new version beside the old
+ *  one, then publishes it with a single store of the root. Readers
+ *  load the root and descend without any lock, retry or write to
+ *  shared memory besides their epoch slot: a lookup is wait-free and
+ *  always sees one whole version of the tree. The replaced nodes are
+ *  retired to the EpochDomain, which frees them once no reader can
+ *  still hold them.
+ *
+ *  Writers are serialized by a mutex: each one copies O(log n) nodes,
+ *  so the tree suits read mostly workloads. Every write replaces the
+ *  root, so writers compare-and-swapping it or locking finer parts of
+ *  the tree would still conflict there and throw their copies away,
+ *  while readers never wait on a writer either way. A write that
+ *  throws deletes its copies and leaves the published tree untouched.
+ *  BinaryTree stays the choice for a single thread.
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+#ifndef CONCURRENTBINARYTREE_HPP_
+#define CONCURRENTBINARYTREE_HPP_
+
+/***********************************************************
+ *                 std includes
+***********************************************************/
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+/***********************************************************
+ *               internal includes
+***********************************************************/
+#include "../Misc/constants.hpp"
+#include "../Misc/EpochDomain.hpp"
+#include "FrozenBinaryTree.hpp"
+
+template < typename T >
+/** @class ConcurrentBinaryTree
+ *  @brief This class define a balanced binary tree that any number of
+ *         threads may read and write at once. Elements are copied in
+ *         and out, equal elements are kept.
+ */
+class ConcurrentBinaryTree final {
+public:
+    /***************************************************************************//**
+    * @brief : Constructor
+    *
+    * @param : none
+    ******************************************************************************/
+    ConcurrentBinaryTree() = default;
+    /***************************************************************************//**
+    * @brief : Destructor, must not run concurrently with other operations
+    *
+    * @param : none
+    ******************************************************************************/
+    ~ConcurrentBinaryTree();
+    ConcurrentBinaryTree( const ConcurrentBinaryTree & ) = delete;
+    auto operator=( const ConcurrentBinaryTree & ) -> ConcurrentBinaryTree& = delete;
+    /***************************************************************************//**
+    * @brief : Insert element to the binary tree
+    *
+    * @param in: data  - data of T type
+    ******************************************************************************/
+    auto insert( const T &data ) -> void;
+    /***************************************************************************//**
+    * @brief : Remove one element equal to data from the binary tree
+    *
+    * @param in : data  - data of T type
+    * @return   : false if no element is equal to data
+    ******************************************************************************/
+    auto erase( const T &data ) -> bool;
+    /***************************************************************************//**
+    * @brief : Find an element equal to data, never blocks
+    *
+    * @param in  : data   - data of T type
+    * @param out : output - receives a copy of the element
+    * @return    : false if no element is equal to data
+    ******************************************************************************/
+    auto find( const T &data, T &output ) const -> bool;
+    /***************************************************************************//**
+    * @brief : Verify if an element equals data, never blocks
+    *
+    * @param in : data  - data of T type
+    * @return   : true if find would succeed
+    ******************************************************************************/
+    auto contains( const T &data ) const -> bool;
+    /***************************************************************************//**
+    * @brief : Find the smallest element not lower than data, never blocks
+    *
+    * @param in  : data   - data of T type
+    * @param out : output - receives a copy of the element
+    * @return    : false if every element is lower than data
+    ******************************************************************************/
+    auto lowerBound( const T &data, T &output ) const -> bool;
+    /***************************************************************************//**
+    * @brief : Delete all elements of the binary tree
+    *
+    * @param - none
+    ******************************************************************************/
+    auto clear() -> void;
+    /***************************************************************************//**
+    * @brief : Get the lenght of the current tree
+    *
+    * @param  - none
+    * @return - lenght of the binary tree
+    ******************************************************************************/
+    auto lenght() const -> std::size_t;
+    /***************************************************************************//**
+    * @brief : Number of elements, exact only when no writer is running
+    *
+    * @param  : none
+    * @return : std::size_t - number of elements
+    ******************************************************************************/
+    auto size() const -> std::size_t;
+    /***************************************************************************//**
+    * @brief : Verify if the tree is empty
+    *
+    * @param  : none
+    * @return : Return true if size() is 0
+    ******************************************************************************/
+    auto empty() const -> bool;
+    /***************************************************************************//**
+    * @brief : Copy one version of the tree into a read-only snapshot, never
+    *          blocks
+    *
+    * @param  - none
+    * @return - FrozenBinaryTree<T> - snapshot of the elements
+    ******************************************************************************/
+    auto freeze() const -> FrozenBinaryTree<T>;
+private:
+    /** @struct Node
+     *  @brief Tree node, immutable once reachable from m_root
+     */
+    struct Node {
+        T data;
+        const Node *left, *right;
+        std::int32_t height;
+    }; // struct Node
+
+    /** @struct Write
+     *  @brief Nodes touched by one writer: the published nodes it replaces,
+     *         retired once the new root is stored, and the nodes it
+     *         allocated, deleted if the write throws
+     */
+    struct Write {
+        std::vector<const Node*> replaced, created;
+    }; // struct Write
+
+    std::atomic<const Node*> m_root {nullptr};
+    std::atomic<std::size_t> m_size {0};
+    alignas(CACHE_LINE_SIZE) std::mutex m_writer;
+    /***************************************************************************//**
+    * @brief : Node holding the smallest element not lower than data
+    *
+    * @param in : data - data of T type
+    * @return   : node, nullptr if every element is lower, valid while the
+    *             caller holds an EpochGuard
+    ******************************************************************************/
+    auto search( const T &data ) const -> const Node*;
+    /***************************************************************************//**
+    * @brief : Build a new version of the tree and publish it, the caller
+    *          holds m_writer
+    *
+    * @param in : build - called with a Write, returns the new root
+    ******************************************************************************/
+    template < typename Function >
+    auto rewrite( Function build ) -> void;
+    /***************************************************************************//**
+    * @brief : Copy of a subtree with data inserted
+    *
+    * @param in : write - nodes touched by the writer
+    * @param in : node  - root of the subtree, may be nullptr
+    * @param in : data  - data of T type
+    * @return   : root of the new subtree
+    ******************************************************************************/
+    auto insert( Write &write, const Node *node, const T &data ) -> const Node*;
+    /***************************************************************************//**
+    * @brief : Copy of a subtree without one element equal to data, which
+    *          must be in the subtree
+    *
+    * @param in : write - nodes touched by the writer
+    * @param in : node  - root of the subtree
+    * @param in : data  - data of T type
+    * @return   : root of the new subtree
+    ******************************************************************************/
+    auto erase( Write &write, const Node *node, const T &data ) -> const Node*;
+    /***************************************************************************//**
+    * @brief : Copy of a subtree without its smallest node
+    *
+    * @param in  : write - nodes touched by the writer
+    * @param in  : node  - root of the subtree, not nullptr
+    * @param out : first - receives the smallest node, already replaced
+    * @return    : root of the new subtree
+    ******************************************************************************/
+    auto eraseFirst( Write &write, const Node *node, const Node *&first ) -> const Node*;
+    /***************************************************************************//**
+    * @brief : Allocate a new node recorded in the write
+    *
+    * @param in : write - nodes touched by the writer
+    * @param in : args  - data, children and height of the node
+    * @return   : Node* - new node
+    ******************************************************************************/
+    template < typename... Args >
+    static auto make( Write &write, Args&&... args ) -> Node*;
+    /***************************************************************************//**
+    * @brief : Writable copy of a node, the node is retired once the writer
+    *          publishes
+    *
+    * @param in : write - nodes touched by the writer
+    * @param in : node  - node to replace
+    * @return   : Node* - copy with the same children
+    ******************************************************************************/
+    static auto copy( Write &write, const Node *node ) -> Node*;
+    /***************************************************************************//**
+    * @brief : Update the height of a new node and rotate it back within
+    *          the AVL bounds, copying the children the rotation moves
+    *
+    * @param in : write - nodes touched by the writer
+    * @param in : node  - new node, not published yet
+    * @return   : root of the balanced subtree
+    ******************************************************************************/
+    static auto rebalance( Write &write, Node *node ) -> const Node*;
+    /***************************************************************************//**
+    * @brief : Call a function on every node of a subtree, the children of
+    *          a node are read before the call so it may free the node
+    *
+    * @param in : node     - root of the subtree, may be nullptr
+    * @param in : function - called with each const Node*
+    ******************************************************************************/
+    template < typename Function >
+    static auto walk( const Node *node, Function function ) -> void;
+    /***************************************************************************//**
+    * @brief  : Height of a subtree
+    *
+    * @param in: node - root of the subtree, may be nullptr
+    * @return  : height kept in the node, 0 for nullptr
+    ******************************************************************************/
+    static auto height( const Node *node ) -> std::int32_t;
+    /***************************************************************************//**
+    * @brief  : Recompute the height of a node from its children
+    *
+    * @param in: node - node whose children are up to date
+    ******************************************************************************/
+    static auto update( Node *node ) -> void;
+}; // class ConcurrentBinaryTree
+/***********************************************************
+ *                Functions definition
+************************************************************/
+template < typename T >
+ConcurrentBinaryTree<T>::~ConcurrentBinaryTree() {
+    walk(m_root.load(std::memory_order_relaxed), [](const Node *node) {
+        delete node;
+    });
+}
+
+template < typename T >
+auto ConcurrentBinaryTree<T>::insert( const T &data ) -> void {
+    std::lock_guard<std::mutex> lock(m_writer);
+    rewrite([this, &data]( Write &write ) {
+        return insert(write, m_root.load(std::memory_order_relaxed), data);
+    });
+    m_size.fetch_add(1, std::memory_order_relaxed);
+}
+
+template < typename T >
+auto ConcurrentBinaryTree<T>::erase( const T &data ) -> bool {
+    std::lock_guard<std::mutex> lock(m_writer);
+    const auto root = m_root.load(std::memory_order_relaxed);
+    // look first so that a missing element copies nothing
+    auto node = root;
+    while (nullptr != node && !(node->data == data))
+        node = (node->data > data) ? node->left : node->right;
+    if (nullptr == node) return false;
+    rewrite([this, root, &data]( Write &write ) {
+        return erase(write, root, data);
+    });
+    m_size.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+template < typename T >
+auto ConcurrentBinaryTree<T>::find( const T &data, T &output ) const -> bool {
+    EpochGuard guard;
+    const auto node = search(data);
+    if (nullptr == node || !(node->data == data)) return false;
+    output = node->data;
+    return true;
+}
+
+template < typename T >
+auto ConcurrentBinaryTree<T>::contains( const T &data ) const -> bool {
+    EpochGuard guard;
+    const auto node = search(data);
+    return (nullptr != node && node->data == data);
+}
+
+template < typename T >
+auto ConcurrentBinaryTree<T>::lowerBound( const T &data, T &output ) const -> bool {
+    EpochGuard guard;
+    const auto node = search(data);
+    if (nullptr == node) return false;
+    output = node->data;
+    return true;
+}
+
+template < typename T >
+auto ConcurrentBinaryTree<T>::clear() -> void {
+    std::lock_guard<std::mutex> lock(m_writer);
+    rewrite([this]( Write &write ) -> const Node* {
+        walk(m_root.load(std::memory_order_relaxed), [&write](const Node *node) {
+            write.replaced.push_back(node);
+        });
+        return nullptr;
+    });
+    m_size.store(0, std::memory_order_relaxed);
+}
+
+template < typename T >
+auto ConcurrentBinaryTree<T>::lenght() const -> std::size_t {
+    EpochGuard guard;
+    return static_cast<std::size_t>(height(m_root.load(std::memory_order_seq_cst)));
+}
+
+template < typename T >
+auto ConcurrentBinaryTree<T>::size() const -> std::size_t {
+    return m_size.load(std::memory_order_relaxed);
+}
+
+template < typename T >
+auto ConcurrentBinaryTree<T>::empty() const -> bool {
+    return (0 == size());
+}
+
+template < typename T >
+auto ConcurrentBinaryTree<T>::freeze() const -> FrozenBinaryTree<T> {
+    std::vector<T> sorted;
+    {
+        EpochGuard guard;
+        std::vector<const Node*> stack;
+        auto node = m_root.load(std::memory_order_seq_cst);
+        while (nullptr != node || !stack.empty()) {
+            for ( ; nullptr != node; node = node->left )
+                stack.push_back(node);
+            node = stack.back();
+            stack.pop_back();
+            sorted.push_back(node->data);
+            node = node->right;
+        }
+    }
+    return FrozenBinaryTree<T>(sorted);
+}
+
+template < typename T >
+auto ConcurrentBinaryTree<T>::search( const T &data ) const -> const Node* {
+    // seq_cst pairs with the epoch pin, see EpochDomain::enter
+    auto node = m_root.load(std::memory_order_seq_cst);
+    const Node *bound = nullptr;
+    while (nullptr != node) {
+        if (data > node->data) {
+            node = node->right;
+        } else {
+            bound = node;
+            node = node->left;
+        }
+    }
+    return bound;
+}
+
+template < typename T >
+template < typename Function >
+auto ConcurrentBinaryTree<T>::rewrite( Function build ) -> void {
+    Write write;
+    const Node *root = nullptr;
+    try {
+        root = build(write);
+    } catch (...) {
+        // nothing was published, the replaced nodes are still in use
+        for ( auto node : write.created )
+            delete node;
+        throw;
+    }
+    // readers entering after this store cannot reach the replaced nodes
+    m_root.store(root, std::memory_order_seq_cst);
+    for ( auto node : write.replaced )
+        retireEpochNode(node);
+}
+
+template < typename T >
+auto ConcurrentBinaryTree<T>::insert( Write &write, const Node *node, const T &data ) -> const Node* {
+    // the recursion is as deep as the tree, which AVL keeps logarithmic
+    if (nullptr == node) return make(write, data, nullptr, nullptr, 1);
+    auto fresh = copy(write, node);
+    if (node->data > data) {
+        fresh->left = insert(write, node->left, data);
+    } else {
+        fresh->right = insert(write, node->right, data);
+    }
+    return rebalance(write, fresh);
+}
+
+template < typename T >
+auto ConcurrentBinaryTree<T>::erase( Write &write, const Node *node, const T &data ) -> const Node* {
+    if (node->data == data) {
+        write.replaced.push_back(node);
+        if (nullptr == node->left) return node->right;
+        if (nullptr == node->right) return node->left;
+        // the smallest element of the right subtree takes the place of data
+        const Node *first = nullptr;
+        const auto right = eraseFirst(write, node->right, first);
+        return rebalance(write, make(write, first->data, node->left, right, node->height));
+    }
+    auto fresh = copy(write, node);
+    if (node->data > data) {
+        fresh->left = erase(write, node->left, data);
+    } else {
+        fresh->right = erase(write, node->right, data);
+    }
+    return rebalance(write, fresh);
+}
+
+template < typename T >
+auto ConcurrentBinaryTree<T>::eraseFirst( Write &write, const Node *node, const Node *&first ) -> const Node* {
+    if (nullptr == node->left) {
+        first = node;
+        write.replaced.push_back(node);
+        return node->right;
+    }
+    auto fresh = copy(write, node);
+    fresh->left = eraseFirst(write, node->left, first);
+    return rebalance(write, fresh);
+}
+
+template < typename T >
+template < typename... Args >
+auto ConcurrentBinaryTree<T>::make( Write &write, Args&&... args ) -> Node* {
+    // room is made first so that the node is never allocated unrecorded
+    write.created.reserve(write.created.size() + 1);
+    auto node = new Node { std::forward<Args>(args)... };
+    write.created.push_back(node);
+    return node;
+}
+
+template < typename T >
+auto ConcurrentBinaryTree<T>::copy( Write &write, const Node *node ) -> Node* {
+    auto fresh = make(write, *node);
+    write.replaced.push_back(node);
+    return fresh;
+}
+
+template < typename T >
+auto ConcurrentBinaryTree<T>::rebalance( Write &write, Node *node ) -> const Node* {
+    update(node);
+    const auto factor = height(node->left) - height(node->right);
+    if (factor > 1) {
+        auto left = copy(write, node->left);
+        if (height(left->left) < height(left->right)) {
+            auto middle = copy(write, left->right);
+            left->right = middle->left;
+            update(left);
+            middle->left = left;
+            left = middle;
+        }
+        node->left = left->right;
+        update(node);
+        left->right = node;
+        update(left);
+        return left;
+    }
+    if (factor < -1) {
+        auto right = copy(write, node->right);
+        if (height(right->right) < height(right->left)) {
+            auto middle = copy(write, right->left);
+            right->left = middle->right;
+            update(right);
+            middle->right = right;
+            right = middle;
+        }
+        node->right = right->left;
+        update(node);
+        right->left = node;
+        update(right);
+        return right;
+    }
+    return node;
+}
+
+template < typename T >
+template < typename Function >
+auto ConcurrentBinaryTree<T>::walk( const Node *node, Function function ) -> void {
+    std::vector<const Node*> stack;
+    if (nullptr != node) stack.push_back(node);
+    while (!stack.empty()) {
+        node = stack.back();
+        stack.pop_back();
+        if (nullptr != node->left) stack.push_back(node->left);
+        if (nullptr != node->right) stack.push_back(node->right);
+        function(node);
+    }
+}
+
+template < typename T >
+auto ConcurrentBinaryTree<T>::height( const Node *node ) -> std::int32_t {
+    return (nullptr == node) ? 0 : node->height;
+}
+
+template < typename T >
+auto ConcurrentBinaryTree<T>::update( Node *node ) -> void {
+    const auto left = height(node->left), right = height(node->right);
+    node->height = 1 + ((left > right) ? left : right);
+}
+
+#endif
@@ -0,0 +1,350 @@
+/** @file DynamicCircularBuffer.hpp
+ *  @brief Class definition of a circular buffer sized at runtime
+ *
+ *  DynamicCircularBuffer takes its capacity from the constructor
+ *  instead of a template parameter: one class serves every capacity
+ *  and it can come from configuration. Elements live in a single
+ *  contiguous block allocated up front, constructed in place like
+ *  the slots of SpscCircularBuffer. reserve and resize allocate a new
+ *  block and move each kept element into it once, oldest first, so
+ *  the ring is unwrapped in the process. CircularBuffer stays the
+ *  choice for capacities known at compile time.
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+#ifndef DYNAMICCIRCULARBUFFER_HPP_
+#define DYNAMICCIRCULARBUFFER_HPP_
+
+/***********************************************************
+ *                   std includes
+***********************************************************/
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+/***********************************************************
+ *                 internal includes
+***********************************************************/
+#include "../Misc/Exception.hpp"
+
+template < typename T >
+/** @class DynamicCircularBuffer
+ *  @brief This class define a circular buffer of a capacity chosen at
+ *         runtime. Once full, each put overwrites the oldest element.
+ *         Not synchronized.
+ */
+class DynamicCircularBuffer final {
+public:
+    /***************************************************************************//**
+    * @brief : Constructor, allocates the block of the elements
+    *
+    * @param in : capacity - maximum number of elements, not null
+    ******************************************************************************/
+    explicit DynamicCircularBuffer( const std::size_t capacity );
+    /***************************************************************************//**
+    * @brief : Destructor, destroys the elements and frees the block
+    *
+    * @param : none
+    ******************************************************************************/
+    ~DynamicCircularBuffer();
+    DynamicCircularBuffer( const DynamicCircularBuffer & ) = delete;
+    auto operator=( const DynamicCircularBuffer & ) -> DynamicCircularBuffer& = delete;
+    /***************************************************************************//**
+    * @brief : add an element to buffer
+    *
+    * @param in : input - const T
+    ******************************************************************************/
+    auto put( const T &input ) -> void;
+    /***************************************************************************//**
+    * @brief : add an element to buffer, input is moved
+    *
+    * @param in : input - T rvalue
+    ******************************************************************************/
+    auto put( T &&input ) -> void;
+    /***************************************************************************//**
+    * @brief : construct an element in place at the end of the buffer, a
+    *          full buffer builds it aside and moves it in once the oldest
+    *          element is dropped
+    *
+    * @param in : args - arguments forwarded to the constructor of T
+    * @return   : Reference to the new element
+    ******************************************************************************/
+    template < typename... Args >
+    auto emplace( Args&&... args ) -> T&;
+    /***************************************************************************//**
+    * @brief : add a block of elements to buffer, the oldest elements are
+    *          overwritten when the block does not fit
+    *
+    * @param in : input - first of count contiguous elements
+    * @param in : count - number of elements, only the last capacity() are kept
+    ******************************************************************************/
+    auto put( const T *input, std::size_t count ) -> void;
+    /***************************************************************************//**
+    * @brief : remove the oldest elements of the buffer
+    *
+    * @param out : output - receives up to count contiguous elements
+    * @param in  : count  - maximum number of elements
+    * @return    : std::size_t - number of elements removed
+    ******************************************************************************/
+    auto get( T *output, const std::size_t count ) -> std::size_t;
+    /***************************************************************************//**
+    * @brief : copy the oldest elements of the buffer without removing them
+    *
+    * @param out : output - receives up to count contiguous elements
+    * @param in  : count  - maximum number of elements
+    * @return    : std::size_t - number of elements copied
+    ******************************************************************************/
+    auto peek( T *output, const std::size_t count ) const -> std::size_t;
+    /***************************************************************************//**
+    * @brief : Remove an element to buffer
+    *
+    * @param in : input - const T
+    ******************************************************************************/
+    auto remove( const T &input ) -> void;
+    /***************************************************************************//**
+    * @brief : Remove all elements in current buffer
+    *
+    * @param : none
+    ******************************************************************************/
+    auto removeAll() -> void;
+    /***************************************************************************//**
+    * @brief : Grow the capacity, elements are kept in order
+    *
+    * @param in : capacity - minimum capacity, a smaller value does nothing
+    ******************************************************************************/
+    auto reserve( const std::size_t capacity ) -> void;
+    /***************************************************************************//**
+    * @brief : Change the capacity, the newest elements that fit are kept
+    *          in order
+    *
+    * @param in : capacity - new capacity, not null
+    ******************************************************************************/
+    auto resize( const std::size_t capacity ) -> void;
+    /***************************************************************************//**
+    * @brief : Verify if circular buffer is empty or not
+    *
+    * @param  : none
+    * @return : Return true if circular buffer is empty
+    ******************************************************************************/
+    auto empty() const -> bool;
+    /***************************************************************************//**
+    * @brief : Number of elements in current buffer
+    *
+    * @param  : none
+    * @return : std::size_t - number of elements, at most capacity()
+    ******************************************************************************/
+    auto count() const -> std::size_t;
+    /***************************************************************************//**
+    * @brief : Maximum number of elements
+    *
+    * @param  : none
+    * @return : std::size_t - capacity of the buffer
+    ******************************************************************************/
+    auto capacity() const -> std::size_t;
+    /***************************************************************************//**
+    * @brief : Index operator
+    *
+    * @param in:  index position
+    * @return  :  Reference to data at position index
+    ******************************************************************************/
+    auto operator[] ( const std::size_t index ) -> T&;
+private:
+    std::allocator<T> m_allocator;
+    T *m_items {nullptr};
+    std::size_t m_capacity {0},
+                m_head {0},
+                m_count {0};
+    /***************************************************************************//**
+    * @brief : Slot of an offset from the oldest element
+    *
+    * @param in : offset - lower than capacity()
+    * @return   : pointer to the slot
+    ******************************************************************************/
+    auto slot( const std::size_t offset ) const -> T*;
+    /***************************************************************************//**
+    * @brief : Destroy the count oldest elements, count <= count()
+    *
+    * @param in : count - number of elements
+    ******************************************************************************/
+    auto discard( const std::size_t count ) -> void;
+    /***************************************************************************//**
+    * @brief : Move the newest elements that fit into a new block. The buffer
+    *          is left untouched if a move throws.
+    *
+    * @param in : capacity - capacity of the new block, not null
+    ******************************************************************************/
+    auto relocate( const std::size_t capacity ) -> void;
+}; // class DynamicCircularBuffer
+/***********************************************************
+ *                Functions definition
+************************************************************/
+template < typename T >
+DynamicCircularBuffer<T>::DynamicCircularBuffer( const std::size_t capacity ) {
+    if (0 == capacity)
+        throw Exception("Capacity must not be null");
+    m_items = m_allocator.allocate(capacity);
+    m_capacity = capacity;
+}
+
+template < typename T >
+DynamicCircularBuffer<T>::~DynamicCircularBuffer() {
+    discard(m_count);
+    m_allocator.deallocate(m_items, m_capacity);
+}
+
+template < typename T >
+auto DynamicCircularBuffer<T>::put( const T &input ) -> void {
+    emplace(input);
+}
+
+template < typename T >
+auto DynamicCircularBuffer<T>::put( T &&input ) -> void {
+    emplace(std::move(input));
+}
+
+template < typename T >
+template < typename... Args >
+auto DynamicCircularBuffer<T>::emplace( Args&&... args ) -> T& {
+    if (m_count == m_capacity) {
+        // args may refer to the oldest element and the constructor may
+        // throw, build the new element before dropping the oldest one
+        T value(std::forward<Args>(args)...);
+        discard(1);
+        auto item = new (slot(m_count)) T(std::move(value));
+        m_count++;
+        return *item;
+    }
+    auto item = new (slot(m_count)) T(std::forward<Args>(args)...);
+    m_count++;
+    return *item;
+}
+
+template < typename T >
+auto DynamicCircularBuffer<T>::put( const T *input, std::size_t count ) -> void {
+    if (count > m_capacity) {
+        input += count - m_capacity;
+        count = m_capacity;
+    }
+    if (m_count + count > m_capacity) {
+        discard(m_count + count - m_capacity);
+    }
+    for ( std::size_t i(0); i < count; ++i, ++m_count )
+        new (slot(m_count)) T(input[i]);
+}
+
+template < typename T >
+auto DynamicCircularBuffer<T>::get( T *output, const std::size_t count ) -> std::size_t {
+    const auto removed = (count < m_count) ? count : m_count;
+    for ( std::size_t i(0); i < removed; ++i )
+        output[i] = std::move(*slot(i));
+    discard(removed);
+    return removed;
+}
+
+template < typename T >
+auto DynamicCircularBuffer<T>::peek( T *output, const std::size_t count ) const -> std::size_t {
+    const auto copied = (count < m_count) ? count : m_count;
+    for ( std::size_t i(0); i < copied; ++i )
+        output[i] = *slot(i);
+    return copied;
+}
+
+template < typename T >
+auto DynamicCircularBuffer<T>::remove( const T &input ) -> void {
+    for ( std::size_t i(0); i < m_count; ++i ) {
+        if (*slot(i) == input) {
+            for ( auto j = i; j + 1 < m_count; ++j )
+                *slot(j) = std::move(*slot(j + 1));
+            slot(m_count - 1)->~T();
+            m_count--;
+            return;
+        }
+    }
+}
+
+template < typename T >
+auto DynamicCircularBuffer<T>::removeAll() -> void {
+    discard(m_count);
+    m_head = 0;
+}
+
+template < typename T >
+auto DynamicCircularBuffer<T>::reserve( const std::size_t capacity ) -> void {
+    if (capacity > m_capacity) {
+        relocate(capacity);
+    }
+}
+
+template < typename T >
+auto DynamicCircularBuffer<T>::resize( const std::size_t capacity ) -> void {
+    if (0 == capacity)
+        throw Exception("Capacity must not be null");
+    if (capacity != m_capacity) {
+        relocate(capacity);
+    }
+}
+
+template < typename T >
+auto DynamicCircularBuffer<T>::empty() const -> bool {
+    return (0 == m_count);
+}
+
+template < typename T >
+auto DynamicCircularBuffer<T>::count() const -> std::size_t {
+    return m_count;
+}
+
+template < typename T >
+auto DynamicCircularBuffer<T>::capacity() const -> std::size_t {
+    return m_capacity;
+}
+
+template < typename T >
+auto DynamicCircularBuffer<T>::operator[] ( const std::size_t index ) -> T& {
+    if (index >= m_count)
+        throw Exception("Index out of range");
+    return *slot(index);
+}
+
+template < typename T >
+auto DynamicCircularBuffer<T>::slot( const std::size_t offset ) const -> T* {
+    const auto position = m_head + offset;
+    return m_items + ((position >= m_capacity) ? position - m_capacity : position);
+}
+
+template < typename T >
+auto DynamicCircularBuffer<T>::discard( const std::size_t count ) -> void {
+    for ( std::size_t i(0); i < count; ++i ) {
+        slot(0)->~T();
+        m_head = (m_head + 1 == m_capacity) ? 0 : m_head + 1;
+        m_count--;
+    }
+}
+
+template < typename T >
+auto DynamicCircularBuffer<T>::relocate( const std::size_t capacity ) -> void {
+    const auto kept = (m_count < capacity) ? m_count : capacity;
+    const auto skipped = m_count - kept;
+    auto items = m_allocator.allocate(capacity);
+    std::size_t moved(0);
+    try {
+        // copies instead of moving when a throwing move would lose elements
+        for ( ; moved < kept; ++moved )
+            new (items + moved) T(std::move_if_noexcept(*slot(skipped + moved)));
+    } catch (...) {
+        for ( std::size_t i(0); i < moved; ++i )
+            items[i].~T();
+        m_allocator.deallocate(items, capacity);
+        throw;
+    }
+    discard(m_count);
+    m_allocator.deallocate(m_items, m_capacity);
+    m_items = items;
+    m_capacity = capacity;
+    m_head = 0;
+    m_count = kept;
+}
+
+#endif
@@ -0,0 +1,161 @@
+/** @file FrozenBinaryTree.hpp
+ *  @brief Class definition of a read-only binary search tree laid out
+ *         in Eytzinger order
+ *
+ *  The tree is an implicit array: the root is at index 1 and the
+ *  children of index k are at 2k and 2k + 1, so a level of the tree is
+ *  contiguous and no pointer is chased. A lookup descends with
+ *  k = 2k + (item < data), without a branch that depends on the data,
+ *  and prefetches the cache line holding the descendants of k a few
+ *  levels down while it compares. BinaryTree::freeze builds one from
+ *  the elements of a tree once it is no longer modified.
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+#ifndef FROZENBINARYTREE_HPP_
+#define FROZENBINARYTREE_HPP_
+
+/***********************************************************
+ *                 std includes
+***********************************************************/
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+template < typename T >
+/** @class FrozenBinaryTree
+ *  @brief This class define an immutable snapshot of a binary search
+ *         tree. Lookups only read it and may run from many threads.
+ */
+class FrozenBinaryTree final {
+public:
+    /***************************************************************************//**
+    * @brief : Constructor
+    *
+    * @param in: sorted - elements in non decreasing order
+    ******************************************************************************/
+    explicit FrozenBinaryTree( const std::vector<T> &sorted = std::vector<T>() );
+    /***************************************************************************//**
+    * @brief : Destructor
+    *
+    * @param : none
+    ******************************************************************************/
+    ~FrozenBinaryTree() = default;
+    /***************************************************************************//**
+    * @brief : Find an element equal to data
+    *
+    * @param in : data  - data of T type
+    * @return   : const T* - pointer to the element, nullptr if absent
+    ******************************************************************************/
+    auto find( const T &data ) const -> const T*;
+    /***************************************************************************//**
+    * @brief : Find the smallest element not lower than data
+    *
+    * @param in : data  - data of T type
+    * @return   : const T* - pointer to the element, nullptr if every
+    *             element is lower than data
+    ******************************************************************************/
+    auto lowerBound( const T &data ) const -> const T*;
+    /***************************************************************************//**
+    * @brief : Verify if an element equals data
+    *
+    * @param in : data  - data of T type
+    * @return   : true if find would not return nullptr
+    ******************************************************************************/
+    auto contains( const T &data ) const -> bool;
+    /***************************************************************************//**
+    * @brief : Number of elements
+    *
+    * @param  : none
+    * @return : std::size_t - number of elements
+    ******************************************************************************/
+    auto size() const -> std::size_t;
+    /***************************************************************************//**
+    * @brief : Verify if the tree is empty
+    *
+    * @param  : none
+    * @return : Return true if size() is 0
+    ******************************************************************************/
+    auto empty() const -> bool;
+private:
+    // index 0 is unused, the root is at 1
+    std::vector<T> m_items;
+    std::size_t m_size {0};
+    /***************************************************************************//**
+    * @brief : Index of the smallest element not lower than data
+    *
+    * @param in : data  - data of T type
+    * @return   : std::size_t - index in m_items, 0 if every element is lower
+    ******************************************************************************/
+    auto search( const T &data ) const -> std::size_t;
+}; // class FrozenBinaryTree
+/***********************************************************
+ *                Functions definition
+************************************************************/
+template < typename T >
+FrozenBinaryTree<T>::FrozenBinaryTree( const std::vector<T> &sorted )
+    : m_items(sorted.size() + 1), m_size(sorted.size()) {
+    if (0 == m_size) return;
+    // in-order walk of the implicit tree, from its leftmost index
+    std::size_t k(1);
+    while (2 * k <= m_size) k *= 2;
+    for ( const auto &item : sorted ) {
+        m_items[k] = item;
+        if (2 * k + 1 <= m_size) {
+            k = 2 * k + 1;
+            while (2 * k <= m_size) k *= 2;
+        } else {
+            // climb while k is a right child, then once more
+            while (k & 1) k >>= 1;
+            k >>= 1;
+        }
+    }
+}
+
+template < typename T >
+auto FrozenBinaryTree<T>::find( const T &data ) const -> const T* {
+    const auto k = search(data);
+    return (0 != k && !(data < m_items[k])) ? &m_items[k] : nullptr;
+}
+
+template < typename T >
+auto FrozenBinaryTree<T>::lowerBound( const T &data ) const -> const T* {
+    const auto k = search(data);
+    return (0 != k) ? &m_items[k] : nullptr;
+}
+
+template < typename T >
+auto FrozenBinaryTree<T>::contains( const T &data ) const -> bool {
+    return (nullptr != find(data));
+}
+
+template < typename T >
+auto FrozenBinaryTree<T>::size() const -> std::size_t {
+    return m_size;
+}
+
+template < typename T >
+auto FrozenBinaryTree<T>::empty() const -> bool {
+    return (0 == m_size);
+}
+
+template < typename T >
+auto FrozenBinaryTree<T>::search( const T &data ) const -> std::size_t {
+    const auto items = m_items.data();
+    std::size_t k(1);
+    while (k <= m_size) {
+        // the 16 descendants of k four levels down are contiguous from 16k,
+        // the address is a hint and may lie past the end of the array
+        __builtin_prefetch(reinterpret_cast<const void*>(
+            reinterpret_cast<std::uintptr_t>(items) + 16 * k * sizeof(T)));
+        k = 2 * k + static_cast<std::size_t>(items[k] < data);
+    }
+    // the bits under the last left turn are right turns past smaller
+    // elements, drop them and that left turn
+    k >>= __builtin_ffsll(static_cast<long long>(~k));
+    return k;
+}
+
+#endif
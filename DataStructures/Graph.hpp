@@ -58,13 +58,13 @@ public:
     * 
     * @param :  edge - single edge
     ******************************************************************************/
-    auto add( const EDGE<T> edge ) -> void;
+    auto add( const EDGE<T> &edge ) -> void;
     /***************************************************************************//**
     * @brief : Function to add list of edges
     * 
     * @param :  edges - list of edges
     ******************************************************************************/
-    auto add( const std::list<EDGE<T>> edges ) -> void;
+    auto add( const std::list<EDGE<T>> &edges ) -> void;
     /***************************************************************************//**
     * @brief : Get number of vertices
     * 
@@ -80,7 +80,7 @@ private:
     * 
     * @param : input 
     ******************************************************************************/
-    auto find( const T input ) -> std::size_t;
+    auto find( const T &input ) -> std::size_t;
 }; // class Graph
 /***********************************************************
  *                Functions definition
@@ -96,7 +96,7 @@ Graph<T>::~Graph() {
 }
 
 template < typename T >
-auto Graph<T>::find( const T input ) -> std::size_t {
+auto Graph<T>::find( const T &input ) -> std::size_t {
     for ( auto i(0); i < vertices; ++i ) {
         if (m_AdjacencyList[i].empty()) continue;
         try {
@@ -110,7 +110,7 @@ auto Graph<T>::find( const T input ) -> std::size_t {
 }
 
 template < typename T >
-auto Graph<T>::add( const EDGE<T> edge ) -> void {
+auto Graph<T>::add( const EDGE<T> &edge ) -> void {
     auto Edge_Pos = find(edge.from);
     static int index = 0;
     if (NOT_DEFINED != Edge_Pos) {
@@ -127,8 +127,8 @@ auto Graph<T>::add( const EDGE<T> edge ) -> void {
 }
 
 template < typename T >
-auto Graph<T>::add( const std::list<EDGE<T>> edges ) -> void {
-    for ( auto l : edges ) {
+auto Graph<T>::add( const std::list<EDGE<T>> &edges ) -> void {
+    for ( const auto &l : edges ) {
         add(l);
     }
 }
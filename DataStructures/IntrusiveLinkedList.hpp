@@ -0,0 +1,361 @@
+/** @file IntrusiveLinkedList.hpp
+ *  @brief Class definition of an intrusive doubly linked list
+ *
+ *  Elements embed their own links by deriving from IntrusiveHook, so
+ *  linking and unlinking an object never allocates nor copies it and
+ *  an object is unlinked in O(1) from its address. The list does not
+ *  own its elements: they must outlive their membership and must be
+ *  removed before being destroyed. The list is not synchronized.
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+#ifndef INTRUSIVELINKEDLIST_HPP_
+#define INTRUSIVELINKEDLIST_HPP_
+
+/******************************
+ *     std includes
+*******************************/
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+/******************************
+ *    internal includes
+*******************************/
+#include "../Misc/node.hpp"
+#include "../Misc/constants.hpp"
+#include "../Misc/Exception.hpp"
+
+template < typename T, typename Tag = DefaultHookTag >
+/** @class IntrusiveLinkedList
+ *  @brief This class define a doubly linked list of objects deriving
+ *         from IntrusiveHook<Tag>.
+ */
+class IntrusiveLinkedList final {
+    using Hook = IntrusiveHook<Tag>;
+    static_assert(std::is_base_of<Hook, T>::value, "T must derive from IntrusiveHook<Tag>");
+public:
+    template < bool IsConst >
+    /** @class BasicIterator
+     *  @brief Bidirectional iterator over the objects of the list
+     */
+    class BasicIterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = typename std::conditional<IsConst, const T*, T*>::type;
+        using reference         = typename std::conditional<IsConst, const T&, T&>::type;
+        /******************************************************************//**
+        * @brief : Constructor
+        *
+        * @param : none
+        **********************************************************************/
+        BasicIterator() = default;
+        /******************************************************************//**
+        * @brief : Conversion from a mutable iterator to a const iterator
+        *
+        * @param in: other - iterator to convert
+        **********************************************************************/
+        template < bool WasConst, typename = typename std::enable_if<IsConst && !WasConst>::type >
+        BasicIterator( const BasicIterator<WasConst> &other ) : m_hook(other.m_hook) {}
+        auto operator++() -> BasicIterator& { m_hook = m_hook->next; return *this; }
+        auto operator++( int ) -> BasicIterator { auto previous = *this; ++(*this); return previous; }
+        auto operator--() -> BasicIterator& { m_hook = m_hook->prev; return *this; }
+        auto operator--( int ) -> BasicIterator { auto previous = *this; --(*this); return previous; }
+        auto operator*() const -> reference { return *operator->(); }
+        auto operator->() const -> pointer { return static_cast<pointer>(m_hook); }
+        template < bool OtherConst >
+        auto operator==( const BasicIterator<OtherConst> &other ) const -> bool { return m_hook == other.m_hook; }
+        template < bool OtherConst >
+        auto operator!=( const BasicIterator<OtherConst> &other ) const -> bool { return m_hook != other.m_hook; }
+    private:
+        using HookPointer = typename std::conditional<IsConst, const Hook*, Hook*>::type;
+        HookPointer m_hook {nullptr};
+        explicit BasicIterator( HookPointer hook ) : m_hook(hook) {}
+        friend class IntrusiveLinkedList<T, Tag>;
+        friend class BasicIterator<!IsConst>;
+    }; // class BasicIterator
+    using Iterator       = BasicIterator<false>;
+    using ConstIterator  = BasicIterator<true>;
+    using iterator       = Iterator;
+    using const_iterator = ConstIterator;
+    /***************************************************************************//**
+    * @brief : Constructor
+    *
+    * @param : none
+    ******************************************************************************/
+    IntrusiveLinkedList();
+    /***************************************************************************//**
+    * @brief : Destructor, unlinks every object
+    *
+    * @param : none
+    ******************************************************************************/
+    ~IntrusiveLinkedList();
+    IntrusiveLinkedList( const IntrusiveLinkedList & ) = delete;
+    auto operator=( const IntrusiveLinkedList & ) -> IntrusiveLinkedList& = delete;
+    /***************************************************************************//**
+    * @brief : Link an object at the end of the list
+    *
+    * @param in: object - object not linked on a list of the same Tag
+    ******************************************************************************/
+    auto add( T &object ) -> void;
+    /***************************************************************************//**
+    * @brief : Link an object at the head of the list
+    *
+    * @param in: object - object not linked on a list of the same Tag
+    ******************************************************************************/
+    auto addFront( T &object ) -> void;
+    /***************************************************************************//**
+    * @brief : Link an object before an iterator position, end() appends
+    *
+    * @param in: object - object not linked on a list of the same Tag
+    * @param in: pos    - iterator of this list
+    ******************************************************************************/
+    auto insert( T &object, const Iterator &pos ) -> void;
+    /***************************************************************************//**
+    * @brief : Unlink an object of this list in O(1)
+    *
+    * @param in: object - object linked on this list
+    ******************************************************************************/
+    auto remove( T &object ) -> void;
+    /***************************************************************************//**
+    * @brief : Unlink every object of the list
+    *
+    * @param : none
+    ******************************************************************************/
+    auto clear() -> void;
+    /***************************************************************************//**
+    * @brief : Unlink first object of the list
+    *
+    * @param : none
+    * @return: the unlinked object, nullptr if the list is empty
+    ******************************************************************************/
+    auto popFront() -> T*;
+    /***************************************************************************//**
+    * @brief : Unlink last object of the list
+    *
+    * @param : none
+    * @return: the unlinked object, nullptr if the list is empty
+    ******************************************************************************/
+    auto popBack() -> T*;
+    /***************************************************************************//**
+    * @brief  : get number of linked objects
+    *
+    * @param  :  none
+    * @return :  std::size_t - size of the list
+    ******************************************************************************/
+    auto size() const -> std::size_t;
+    /***************************************************************************//**
+    * @brief  : check if the list is empty
+    *
+    * @param  :  none
+    * @return :  bool - returns true if size is equal to 0
+    ******************************************************************************/
+    auto empty() const -> bool;
+    /***************************************************************************//**
+    * @brief  : Return first object of the list
+    *
+    * @param  :  none
+    * @return :  T& - reference to the first object
+    ******************************************************************************/
+    auto front() -> T&;
+    /***************************************************************************//**
+    * @brief  : Return last object of the list
+    *
+    * @param  :  none
+    * @return :  T& - reference to the last object
+    ******************************************************************************/
+    auto back() -> T&;
+    /***************************************************************************//**
+    * @brief  : Reverse the list
+    *
+    * @param  :  none
+    ******************************************************************************/
+    auto reverse() -> void;
+    /***************************************************************************//**
+    * @brief  : Return an iterator to an object linked on this list in O(1)
+    *
+    * @param  in:  object - object linked on this list
+    * @return   :  iterator to object
+    ******************************************************************************/
+    auto iteratorTo( T &object ) -> Iterator;
+    /***************************************************************************//**
+    * @brief  : Return an iterator to the first object
+    *
+    * @param  :  none
+    * @return :  iterator to the head, equal to end() when the list is empty
+    ******************************************************************************/
+    auto begin() -> Iterator;
+    auto begin() const -> ConstIterator;
+    /***************************************************************************//**
+    * @brief  : Return the past-the-end iterator
+    *
+    * @param  :  none
+    * @return :  iterator following the last object
+    ******************************************************************************/
+    auto end() -> Iterator;
+    auto end() const -> ConstIterator;
+private:
+    Hook m_root;
+    std::size_t m_size {0};
+    /***************************************************************************//**
+    * @brief : Link hook before next
+    *
+    * @param in: hook - hook of the object to link
+    * @param in: next - hook following the new one, m_root appends
+    ******************************************************************************/
+    auto linkBefore( Hook *hook, Hook *next ) -> void;
+    /***************************************************************************//**
+    * @brief : Unlink a linked hook and reset its links
+    *
+    * @param in: hook - hook of the object to unlink
+    ******************************************************************************/
+    auto unlink( Hook *hook ) -> void;
+}; // class IntrusiveLinkedList
+/***********************************************************
+ *                Functions definition
+************************************************************/
+template < typename T, typename Tag >
+IntrusiveLinkedList<T, Tag>::IntrusiveLinkedList() {
+    m_root.next = m_root.prev = &m_root;
+}
+
+template < typename T, typename Tag >
+IntrusiveLinkedList<T, Tag>::~IntrusiveLinkedList() {
+    clear();
+}
+
+template < typename T, typename Tag >
+auto IntrusiveLinkedList<T, Tag>::add( T &object ) -> void {
+    linkBefore(static_cast<Hook*>(&object), &m_root);
+}
+
+template < typename T, typename Tag >
+auto IntrusiveLinkedList<T, Tag>::addFront( T &object ) -> void {
+    linkBefore(static_cast<Hook*>(&object), m_root.next);
+}
+
+template < typename T, typename Tag >
+auto IntrusiveLinkedList<T, Tag>::insert( T &object, const Iterator &pos ) -> void {
+    if (nullptr == pos.m_hook)
+        throw Exception("Access to a non allocated memory");
+    linkBefore(static_cast<Hook*>(&object), pos.m_hook);
+}
+
+template < typename T, typename Tag >
+auto IntrusiveLinkedList<T, Tag>::remove( T &object ) -> void {
+    auto hook = static_cast<Hook*>(&object);
+    if (!hook->linked())
+        throw Exception("Object is not linked");
+    unlink(hook);
+}
+
+template < typename T, typename Tag >
+auto IntrusiveLinkedList<T, Tag>::clear() -> void {
+    auto hook = m_root.next;
+    while (hook != &m_root) {
+        auto next = hook->next;
+        hook->next = hook->prev = nullptr;
+        hook = next;
+    }
+    m_root.next = m_root.prev = &m_root;
+    m_size = 0;
+}
+
+template < typename T, typename Tag >
+auto IntrusiveLinkedList<T, Tag>::popFront() -> T* {
+    if (0 == m_size) return nullptr;
+    auto hook = m_root.next;
+    unlink(hook);
+    return static_cast<T*>(hook);
+}
+
+template < typename T, typename Tag >
+auto IntrusiveLinkedList<T, Tag>::popBack() -> T* {
+    if (0 == m_size) return nullptr;
+    auto hook = m_root.prev;
+    unlink(hook);
+    return static_cast<T*>(hook);
+}
+
+template < typename T, typename Tag >
+auto IntrusiveLinkedList<T, Tag>::size() const -> std::size_t {
+    return m_size;
+}
+
+template < typename T, typename Tag >
+auto IntrusiveLinkedList<T, Tag>::empty() const -> bool {
+    return (m_size == 0);
+}
+
+template < typename T, typename Tag >
+auto IntrusiveLinkedList<T, Tag>::front() -> T& {
+    if (0 == m_size)
+        throw Exception("Access to a non allocated memory");
+    return *static_cast<T*>(m_root.next);
+}
+
+template < typename T, typename Tag >
+auto IntrusiveLinkedList<T, Tag>::back() -> T& {
+    if (0 == m_size)
+        throw Exception("Access to a non allocated memory");
+    return *static_cast<T*>(m_root.prev);
+}
+
+template < typename T, typename Tag >
+auto IntrusiveLinkedList<T, Tag>::reverse() -> void {
+    auto hook = &m_root;
+    do {
+        std::swap(hook->next, hook->prev);
+        hook = hook->prev;
+    } while (hook != &m_root);
+}
+
+template < typename T, typename Tag >
+auto IntrusiveLinkedList<T, Tag>::iteratorTo( T &object ) -> Iterator {
+    return Iterator(static_cast<Hook*>(&object));
+}
+
+template < typename T, typename Tag >
+auto IntrusiveLinkedList<T, Tag>::begin() -> Iterator {
+    return Iterator(m_root.next);
+}
+
+template < typename T, typename Tag >
+auto IntrusiveLinkedList<T, Tag>::begin() const -> ConstIterator {
+    return ConstIterator(m_root.next);
+}
+
+template < typename T, typename Tag >
+auto IntrusiveLinkedList<T, Tag>::end() -> Iterator {
+    return Iterator(&m_root);
+}
+
+template < typename T, typename Tag >
+auto IntrusiveLinkedList<T, Tag>::end() const -> ConstIterator {
+    return ConstIterator(&m_root);
+}
+
+template < typename T, typename Tag >
+auto IntrusiveLinkedList<T, Tag>::linkBefore( Hook *hook, Hook *next ) -> void {
+    if (hook->linked())
+        throw Exception("Object is already linked");
+    hook->next = next;
+    hook->prev = next->prev;
+    next->prev->next = hook;
+    next->prev = hook;
+    m_size++;
+}
+
+template < typename T, typename Tag >
+auto IntrusiveLinkedList<T, Tag>::unlink( Hook *hook ) -> void {
+    hook->prev->next = hook->next;
+    hook->next->prev = hook->prev;
+    hook->next = hook->prev = nullptr;
+    m_size--;
+}
+
+#endif
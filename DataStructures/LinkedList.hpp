@@ -1,6 +1,21 @@
 /** @file LinkedList.hpp
  *  @brief Class definition of a doubly linked list
  *
+ *  The list is guarded by a writer preferring reader-writer lock:
+ *  mutators take it exclusively while size, empty, front, back,
+ *  operator[], find and parallelReduce share it, so readers run in
+ *  parallel and only wait for writers.
+ *
+ *  References and iterators point at nodes and stay valid until the
+ *  element they designate is removed, whatever else is inserted or
+ *  removed. Walking the list while other threads mutate it requires
+ *  holding readLock() for the whole traversal; the lock is not
+ *  recursive so the thread holding it must not call any other
+ *  locking method of the same list. Producer / consumer code
+ *  that only appends and pops the front can use LockFreeQueue
+ *  instead, and objects that already live elsewhere can be linked
+ *  without copy on an IntrusiveLinkedList.
+ *
  *  @author Massinissa Bandou
  *  @bug No known bugs.
  */
@@ -13,6 +28,16 @@
 #include <iostream>
 #include <thread>
 #include <mutex>
+#include <shared_mutex>
+#include <utility>
+#include <initializer_list>
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <vector>
 
 /******************************
  *    internal includes
@@ -20,6 +45,8 @@
 #include "../Misc/node.hpp" 
 #include "../Misc/constants.hpp"
 #include "../Misc/Exception.hpp"
+#include "../Misc/SkipIndex.hpp"
+#include "../Misc/SharedMutex.hpp"
 
 /** @enum REMOVE_ENUM
 *   @brief options used to remove elements from a linked list
@@ -37,43 +64,103 @@ template < typename T >
  */
 class LinkedList final {
 public:
-    class Iterator {
+    template < bool IsConst >
+    /** @class BasicIterator
+     *  @brief Bidirectional iterator over the elements of the list. Each
+     *         iterator holds its own position, end() is past the last
+     *         element and decrementing it reaches the tail.
+     */
+    class BasicIterator {
     public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = typename std::conditional<IsConst, const T*, T*>::type;
+        using reference         = typename std::conditional<IsConst, const T&, T&>::type;
         /******************************************************************//**
         * @brief : Constructor
         *           
         * @param : none
         **********************************************************************/
-        Iterator() = default;
+        BasicIterator() = default;
+        /******************************************************************//**
+        * @brief : Conversion from a mutable iterator to a const iterator
+        *           
+        * @param in: other - iterator to convert
+        **********************************************************************/
+        template < bool WasConst, typename = typename std::enable_if<IsConst && !WasConst>::type >
+        BasicIterator( const BasicIterator<WasConst> &other );
         /******************************************************************//**
         * @brief : Destructor
         *           
         * @param : none
         **********************************************************************/
-        ~Iterator() = default;
+        ~BasicIterator() = default;
+        /******************************************************************//**
+        * @brief : Pre increment operator
+        *           
+        * @param : none
+        **********************************************************************/
+        auto operator++() -> BasicIterator&;
         /******************************************************************//**
         * @brief : Post increment operator
         *           
         * @param : none
         **********************************************************************/
-        auto operator++() -> Iterator&;
+        auto operator++( int ) -> BasicIterator;
+        /******************************************************************//**
+        * @brief : Pre decrement operator, end() moves to the last element
+        *           
+        * @param : none
+        **********************************************************************/
+        auto operator--() -> BasicIterator&;
         /******************************************************************//**
         * @brief : Post decrement operator
         *           
         * @param : none
         **********************************************************************/
-        auto operator--() -> Iterator&;
+        auto operator--( int ) -> BasicIterator;
         /******************************************************************//**
         * @brief : Dereference operator
         *           
         * @param : none
-        * @return: Pointer to current node
+        * @return: Reference to current element
+        **********************************************************************/
+        auto operator*() const -> reference;
+        /******************************************************************//**
+        * @brief : Member access operator
+        *           
+        * @param : none
+        * @return: Pointer to current element
         **********************************************************************/
-        auto operator->() -> Node<T>*;
+        auto operator->() const -> pointer;
+        /******************************************************************//**
+        * @brief : Equality operators, iterators are equal when they point
+        *          at the same node
+        *           
+        * @param in: other - iterator to compare with
+        **********************************************************************/
+        template < bool OtherConst >
+        auto operator==( const BasicIterator<OtherConst> &other ) const -> bool;
+        template < bool OtherConst >
+        auto operator!=( const BasicIterator<OtherConst> &other ) const -> bool;
     private:
         Node<T> *current_node {nullptr};
+        const LinkedList<T> *m_list {nullptr};
+        /******************************************************************//**
+        * @brief : Constructor used by the list
+        *           
+        * @param in: node - current node, nullptr for end()
+        * @param in: list - list iterated over
+        **********************************************************************/
+        BasicIterator( Node<T> *node, const LinkedList<T> *list );
         friend class LinkedList<T>;
-    }; // class Iterator
+        friend class BasicIterator<!IsConst>;
+    }; // class BasicIterator
+    using Iterator       = BasicIterator<false>;
+    using ConstIterator  = BasicIterator<true>;
+    using iterator       = Iterator;
+    using const_iterator = ConstIterator;
     /***************************************************************************//**
     * @brief : Constructor
     *           
@@ -91,13 +178,51 @@ public:
     *           
     * @param in: data  - const T type
     ******************************************************************************/
-    auto add( const T data ) -> void;
+    auto add( const T &data ) -> void;
+    /***************************************************************************//**
+    * @brief : Append a new element to the current linked list, data is moved
+    *           
+    * @param in: data  - T rvalue
+    ******************************************************************************/
+    auto add( T &&data ) -> void;
     /***************************************************************************//**
     * @brief : Add new element to the head of the current linked list
     *           
     * @param in: data  - const T type
     ******************************************************************************/
-    auto addFront( const T data ) -> void;
+    auto addFront( const T &data ) -> void;
+    /***************************************************************************//**
+    * @brief : Add new element to the head of the current linked list, data
+    *          is moved
+    *           
+    * @param in: data  - T rvalue
+    ******************************************************************************/
+    auto addFront( T &&data ) -> void;
+    /***************************************************************************//**
+    * @brief : Construct a new element in place at the end of the list
+    *           
+    * @param in: args  - arguments forwarded to the constructor of T
+    * @return  : Reference to the new element
+    ******************************************************************************/
+    template < typename... Args >
+    auto emplace_back( Args&&... args ) -> T&;
+    /***************************************************************************//**
+    * @brief : Construct a new element in place at the head of the list
+    *           
+    * @param in: args  - arguments forwarded to the constructor of T
+    * @return  : Reference to the new element
+    ******************************************************************************/
+    template < typename... Args >
+    auto emplace_front( Args&&... args ) -> T&;
+    /***************************************************************************//**
+    * @brief : Construct a new element in place before position index
+    *           
+    * @param in: index - position of the new element, size() appends
+    * @param in: args  - arguments forwarded to the constructor of T
+    * @return  : Reference to the new element
+    ******************************************************************************/
+    template < typename... Args >
+    auto emplace( const std::size_t index, Args&&... args ) -> T&;
     /***************************************************************************//**
     * @brief : Remove first or all elements that contain data 
     *           
@@ -105,7 +230,7 @@ public:
     * @param in: option - removal option (remove first of element or remove 
     *                                     all elements that contain data)
     ******************************************************************************/
-    auto remove( const T data, REMOVE_ENUM option = REMOVE_FIRST_OF ) -> void;
+    auto remove( const T &data, REMOVE_ENUM option = REMOVE_FIRST_OF ) -> void;
     /***************************************************************************//**
     * @brief : Remove all element of the linked list
     *           
@@ -125,6 +250,46 @@ public:
     ******************************************************************************/
     auto popBack() -> void;
     /***************************************************************************//**
+    * @brief : Append every element of [first, last). Nodes are built before
+    *          the list is locked and linked in a single critical section.
+    *           
+    * @param in: first - iterator to the first element to append
+    * @param in: last  - iterator past the last element to append
+    ******************************************************************************/
+    template < typename InputIt >
+    auto addRange( InputIt first, InputIt last ) -> void;
+    /***************************************************************************//**
+    * @brief : Append every element of an initializer list in a single critical
+    *          section
+    *           
+    * @param in: list - elements to append
+    ******************************************************************************/
+    auto append( std::initializer_list<T> list ) -> void;
+    /***************************************************************************//**
+    * @brief : Move every node of other to the end of this list without copying
+    *          or allocating, other is left empty
+    *           
+    * @param in: other - list to empty
+    ******************************************************************************/
+    auto splice( LinkedList<T> &&other ) -> void;
+    /***************************************************************************//**
+    * @brief : remove up to count elements from the head of the linked list
+    *           
+    * @param in: count - number of elements to remove
+    * @return  : std::size_t - number of elements removed
+    ******************************************************************************/
+    auto popFront( const std::size_t count ) -> std::size_t;
+    /***************************************************************************//**
+    * @brief : Move every element to an output iterator and empty the list.
+    *          The nodes are detached under the lock, elements are moved out
+    *          once it is released.
+    *           
+    * @param out: out - output iterator receiving the elements in order
+    * @return   : iterator past the last element written
+    ******************************************************************************/
+    template < typename OutputIt >
+    auto drainTo( OutputIt out ) -> OutputIt;
+    /***************************************************************************//**
     * @brief  : get current linked list size
     * 
     * @param  :  none
@@ -142,16 +307,18 @@ public:
     * @brief  : Return first element of the current linked list 
     * 
     * @param  :  none
-    * @return :  T - first element data
+    * @return :  T& - reference to the first element data
     ******************************************************************************/
-    auto front() const -> T;
+    auto front() -> T&;
+    auto front() const -> const T&;
     /***************************************************************************//**
     * @brief  : Return last element of the current linked list 
     * 
     * @param  :  none
-    * @return :  T - last element data
+    * @return :  T& - reference to the last element data
     ******************************************************************************/
-    auto back() const -> T;
+    auto back() -> T&;
+    auto back() const -> const T&;
     /***************************************************************************//**
     * @brief  : Reverse the current linked list 
     * 
@@ -159,33 +326,149 @@ public:
     ******************************************************************************/
     auto reverse() -> void;
     /***************************************************************************//**
+    * @brief  : Sort the list in ascending order by relinking its nodes, no
+    *           element is copied nor allocated. Integral elements are radix
+    *           sorted in O(n), others merge sorted in O(n log n).
+    * 
+    * @param  :  none
+    ******************************************************************************/
+    auto sort() -> void;
+    /***************************************************************************//**
+    * @brief  : Stable bottom-up merge sort relinking the nodes in O(n log n)
+    * 
+    * @param  in:  comp - strict weak ordering (const T&, const T&) -> bool
+    ******************************************************************************/
+    template < typename Compare >
+    auto sort( Compare comp ) -> void;
+    /***************************************************************************//**
+    * @brief  : Remove every element equal to the element preceding it
+    * 
+    * @param  in:  pred - equivalence (const T&, const T&) -> bool, defaults
+    *                     to operator==
+    * @return   :  std::size_t - number of elements removed
+    ******************************************************************************/
+    auto unique() -> std::size_t;
+    template < typename BinaryPredicate >
+    auto unique( BinaryPredicate pred ) -> std::size_t;
+    /***************************************************************************//**
+    * @brief  : Merge a sorted list into this sorted list. The nodes of other
+    *           are relinked, not copied, and other is left empty. Equivalent
+    *           elements of this list come first.
+    * 
+    * @param  in:  other - sorted list to empty
+    * @param  in:  comp  - ordering both lists are sorted with, defaults to
+    *                      operator<
+    ******************************************************************************/
+    auto merge( LinkedList<T> &other ) -> void;
+    template < typename Compare >
+    auto merge( LinkedList<T> &other, Compare comp ) -> void;
+    /***************************************************************************//**
+    * @brief  : Remove every element satisfying pred. Above PARALLEL_MIN_CHUNK
+    *           elements pred is evaluated by several threads at once and must
+    *           be safe to call concurrently.
+    * 
+    * @param  in:  pred    - predicate (const T&) -> bool
+    * @param  in:  threads - maximum number of threads, 0 picks the hardware
+    *                        concurrency
+    * @return   :  std::size_t - number of elements removed
+    ******************************************************************************/
+    template < typename Predicate >
+    auto remove_if( Predicate pred, std::size_t threads = 0 ) -> std::size_t;
+    /***************************************************************************//**
     * @brief  : Find first node that contains data 
     * 
     * @param  in:  data - const T
-    * @return   :  Reference to the iterator
+    * @return   :  iterator to the element, end() if data is not found
     ******************************************************************************/
-    auto find( const T data ) const -> Iterator&;
+    auto find( const T &data ) -> Iterator;
+    auto find( const T &data ) const -> ConstIterator;
     /***************************************************************************//**
-    * @brief  : Find first node that contains data 
+    * @brief  : Insert a new element next to an iterator position. The element
+    *           goes before the head, after any other node and at the end of
+    *           the list for end().
     * 
     * @param  in:  data - const T
     * @param  in:  pos - iterator position
     ******************************************************************************/
-    auto insert( const T data, Iterator &pos ) -> void;
+    auto insert( const T &data, const Iterator &pos ) -> void;
+    /***************************************************************************//**
+    * @brief  : Insert a new element before position index
+    * 
+    * @param  in:  data  - const T
+    * @param  in:  index - position of the new element, size() appends
+    ******************************************************************************/
+    auto insert( const T &data, const std::size_t index ) -> void;
+    /***************************************************************************//**
+    * @brief  : Maintain a positional index so that operator[] and positional
+    *           insert run in O(log n). Mutators keep it up to date.
+    * 
+    * @param  :  none
+    ******************************************************************************/
+    auto enableIndex() -> void;
+    /***************************************************************************//**
+    * @brief  : Drop the positional index, operator[] walks the list again
+    * 
+    * @param  :  none
+    ******************************************************************************/
+    auto disableIndex() -> void;
+    /***************************************************************************//**
+    * @brief  : check if a positional index is maintained
+    * 
+    * @param  :  none
+    * @return :  bool - true if operator[] runs in O(log n)
+    ******************************************************************************/
+    auto indexed() const -> bool;
     /***************************************************************************//**
-    * @brief  : Return reference to begining of the iterator
+    * @brief  : Take the list lock in shared mode, mutators block until the
+    *           returned lock is released
     * 
     * @param  :  none
-    * @return :  Reference of the iterator
+    * @return :  lock owning m_mutex in shared mode
     ******************************************************************************/
-    auto begin() -> Iterator&;
+    auto readLock() const -> std::shared_lock<SharedMutex>;
     /***************************************************************************//**
-    * @brief  : Return reference to end of the iterator
+    * @brief  : Return an iterator to the first element
     * 
     * @param  :  none
-    * @return :  Reference of the iterator
+    * @return :  iterator to the head, equal to end() when the list is empty
     ******************************************************************************/
-    auto end() -> Iterator&;
+    auto begin() -> Iterator;
+    auto begin() const -> ConstIterator;
+    auto cbegin() const -> ConstIterator;
+    /***************************************************************************//**
+    * @brief  : Return the past-the-end iterator
+    * 
+    * @param  :  none
+    * @return :  iterator following the last element
+    ******************************************************************************/
+    auto end() -> Iterator;
+    auto end() const -> ConstIterator;
+    auto cend() const -> ConstIterator;
+    /***************************************************************************//**
+    * @brief  : Call function on every element, the list is split into
+    *           contiguous chunks walked by separate threads. The list is
+    *           locked for the whole traversal.
+    * 
+    * @param  in:  function - callable taking a T&, called once per element
+    * @param  in:  threads  - maximum number of threads, 0 picks the hardware
+    *                         concurrency
+    ******************************************************************************/
+    template < typename Function >
+    auto parallelForEach( Function function, std::size_t threads = 0 ) -> void;
+    /***************************************************************************//**
+    * @brief  : Reduce the list in parallel. Each chunk folds its elements
+    *           into a copy of init with accumulate, the partial results are
+    *           then folded in order with combine.
+    * 
+    * @param  in:  init       - identity value of combine
+    * @param  in:  accumulate - callable (R, const T&) -> R
+    * @param  in:  combine    - associative callable (R, R) -> R
+    * @param  in:  threads    - maximum number of threads, 0 picks the hardware
+    *                           concurrency
+    * @return   :  R - reduced value, init for an empty list
+    ******************************************************************************/
+    template < typename R, typename Accumulate, typename Combine >
+    auto parallelReduce( R init, Accumulate accumulate, Combine combine, std::size_t threads = 0 ) const -> R;
     /***************************************************************************//**
     * @brief : Search index operator
     * 
@@ -193,128 +476,380 @@ public:
     * @return  :  Reference to   
     ******************************************************************************/
     auto operator[] ( const std::size_t index ) -> T&;
+    auto operator[] ( const std::size_t index ) const -> const T&;
 private:
     Node<T> *head {nullptr}, 
             *tail {nullptr};
-    Iterator itr;
     std::size_t m_size {0};
-    std::mutex m_mutex;
+    mutable SharedMutex m_mutex;
+    NodePool<Node<T>> m_pool;
+    SkipIndex<T> *m_index {nullptr};
+    /***************************************************************************//**
+    * @brief : Link a new node after prev, caller must hold m_mutex
+    *           
+    * @param in: prev  - node to link after, nullptr links at the head
+    * @param in: index - position of the new node
+    * @param in: args  - arguments forwarded to the constructor of T
+    * @return  : the new node
+    ******************************************************************************/
+    template < typename... Args >
+    auto linkAfter( Node<T> *prev, const std::size_t index, Args&&... args ) -> Node<T>*;
+    /***************************************************************************//**
+    * @brief : Unlink and free a node, caller must hold m_mutex
+    *           
+    * @param in: node  - node to remove
+    * @param in: index - position of the node
+    ******************************************************************************/
+    auto unlink( Node<T> *node, const std::size_t index ) -> void;
+    /***************************************************************************//**
+    * @brief : Find the node at position index, caller must hold m_mutex,
+    *          shared ownership is enough
+    *           
+    * @param in: index - position lower than m_size
+    * @return  : node at position index
+    ******************************************************************************/
+    auto nodeAt( const std::size_t index ) const -> Node<T>*;
+    /***************************************************************************//**
+    * @brief : Position of a node, only needed to keep the index up to date
+    *           
+    * @param in: node - node of the list
+    * @return  : position of node
+    ******************************************************************************/
+    auto positionOf( const Node<T> *node ) const -> std::size_t;
+    /***************************************************************************//**
+    * @brief : Link a chain of nodes owned by m_pool at the end of the list,
+    *          caller must hold m_mutex
+    *           
+    * @param in: first - first node of the chain
+    * @param in: last  - last node of the chain
+    * @param in: count - number of nodes of the chain
+    ******************************************************************************/
+    auto linkChain( Node<T> *first, Node<T> *last, const std::size_t count ) -> void;
+    /***************************************************************************//**
+    * @brief : Split the list into contiguous chunks and run task on each of
+    *          them in its own thread, caller must hold m_mutex
+    *           
+    * @param in: threads - maximum number of threads, 0 picks the hardware
+    *                      concurrency
+    * @param in: task    - callable (chunk, first node, position of the first
+    *                      node, node count)
+    * @return  : number of chunks
+    ******************************************************************************/
+    template < typename Task >
+    auto forEachChunk( std::size_t threads, Task task ) const -> std::size_t;
+    /***************************************************************************//**
+    * @brief : Merge two sorted chains following their next links only
+    *           
+    * @param in: first  - sorted chain, wins ties
+    * @param in: second - sorted chain
+    * @param in: comp   - ordering of both chains
+    * @return  : first node of the merged chain
+    ******************************************************************************/
+    template < typename Compare >
+    static auto mergeChains( Node<T> *first, Node<T> *second, Compare &comp ) -> Node<T>*;
+    /***************************************************************************//**
+    * @brief : Make first the head of the list and rebuild the prev links, the
+    *          tail and the index from the next links, caller must hold m_mutex
+    *           
+    * @param in: first - first node of a nullptr terminated chain of m_size nodes
+    ******************************************************************************/
+    auto relinkChain( Node<T> *first ) -> void;
+    /***************************************************************************//**
+    * @brief : Sort dispatch, radix sort for integral T and merge sort otherwise
+    *           
+    * @param in: integral - std::true_type if T is an integral type
+    ******************************************************************************/
+    auto sortNodes( std::true_type integral ) -> void;
+    auto sortNodes( std::false_type integral ) -> void;
+    /***************************************************************************//**
+    * @brief : Stable bottom-up merge sort, caller must hold m_mutex
+    *           
+    * @param in: comp - strict weak ordering of the elements
+    ******************************************************************************/
+    template < typename Compare >
+    auto mergeSort( Compare &comp ) -> void;
 }; // class LinkedList
 /***********************************************************
  *                Functions definition
 ************************************************************/
 template < typename T >
 LinkedList<T>::~LinkedList() {
-    removeNodes(head);
+    removeNodes(m_pool, head);
     head = tail = nullptr;
+    delete m_index;
 }
 
 template < typename T >
-auto LinkedList<T>::add( const T data ) -> void {
-    std::lock_guard<std::mutex> guard(m_mutex);
-    if (nullptr == head) {
-        head = createNewNode(data);
-        tail = head;
-    } else {
-        auto node = createNewNode(data);
-        node->prev = tail;
-        tail->next = node;
-        tail = node;
-    }
+auto LinkedList<T>::add( const T &data ) -> void {
+    std::lock_guard<SharedMutex> guard(m_mutex);
+    linkAfter(tail, m_size, data);
+}
+
+template < typename T >
+auto LinkedList<T>::add( T &&data ) -> void {
+    std::lock_guard<SharedMutex> guard(m_mutex);
+    linkAfter(tail, m_size, std::move(data));
+}
+
+template < typename T >
+auto LinkedList<T>::addFront( const T &data ) -> void {
+    std::lock_guard<SharedMutex> guard(m_mutex);
+    linkAfter(nullptr, 0, data);
+}
+
+template < typename T >
+auto LinkedList<T>::addFront( T &&data ) -> void {
+    std::lock_guard<SharedMutex> guard(m_mutex);
+    linkAfter(nullptr, 0, std::move(data));
+}
+
+template < typename T >
+template < typename... Args >
+auto LinkedList<T>::emplace_back( Args&&... args ) -> T& {
+    std::lock_guard<SharedMutex> guard(m_mutex);
+    return linkAfter(tail, m_size, std::forward<Args>(args)...)->data;
+}
+
+template < typename T >
+template < typename... Args >
+auto LinkedList<T>::emplace_front( Args&&... args ) -> T& {
+    std::lock_guard<SharedMutex> guard(m_mutex);
+    return linkAfter(nullptr, 0, std::forward<Args>(args)...)->data;
+}
+
+template < typename T >
+template < typename... Args >
+auto LinkedList<T>::emplace( const std::size_t index, Args&&... args ) -> T& {
+    std::lock_guard<SharedMutex> guard(m_mutex);
+    if (index > m_size)
+        throw Exception("Index out of range");
+    auto prev = (0 == index) ? nullptr : nodeAt(index - 1);
+    return linkAfter(prev, index, std::forward<Args>(args)...)->data;
+}
+
+template < typename T >
+template < typename... Args >
+auto LinkedList<T>::linkAfter( Node<T> *prev, const std::size_t index, Args&&... args ) -> Node<T>* {
+    auto next = (nullptr != prev) ? prev->next : head;
+    auto node = emplaceNewNode(m_pool, next, prev, std::forward<Args>(args)...);
+    if (nullptr != prev) prev->next = node;
+    else head = node;
+    if (nullptr != next) next->prev = node;
+    else tail = node;
     m_size++;
+    if (nullptr != m_index) m_index->inserted(index, node);
+    return node;
 }
 
 template < typename T >
-auto LinkedList<T>::addFront( const T data ) -> void {
-    if (nullptr == head) {
-        add(data);
-    } else {
-        auto new_node = createNewNode(data, head);
-        head->prev = new_node;
-        head = new_node;
-        m_size++;
+auto LinkedList<T>::unlink( Node<T> *node, const std::size_t index ) -> void {
+    auto prev = node->prev;
+    auto next = node->next;
+    if (nullptr != prev) prev->next = next;
+    else head = next;
+    if (nullptr != next) next->prev = prev;
+    else tail = prev;
+    removeNode(m_pool, node);
+    m_size--;
+    if (nullptr != m_index) m_index->erased(index);
+}
+
+template < typename T >
+auto LinkedList<T>::nodeAt( const std::size_t index ) const -> Node<T>* {
+    if (nullptr != m_index)
+        return m_index->at(head, index);
+    auto node = head;
+    for ( std::size_t i(0); i < index; ++i ) {
+        node = node->next;
     }
+    return node;
 }
 
 template < typename T >
-auto LinkedList<T>::remove( const T data, REMOVE_ENUM option ) -> void {
-    std::lock_guard<std::mutex> guard(m_mutex);
+auto LinkedList<T>::positionOf( const Node<T> *node ) const -> std::size_t {
+    std::size_t index = 0;
+    for ( auto n = node->prev; nullptr != n; n = n->prev )
+        index++;
+    return index;
+}
+
+template < typename T >
+auto LinkedList<T>::remove( const T &data, REMOVE_ENUM option ) -> void {
+    std::lock_guard<SharedMutex> guard(m_mutex);
     auto node = head;
+    std::size_t index = 0;
     while (nullptr != node) {
+        auto next = node->next;
         if (node->data == data){
-            auto prev = node->prev;
-            auto next = node->next;
-            if (head == node) head = next;
-            if (tail == node) tail = next;
-            if (nullptr != prev) {
-                prev->next = next;
-                if (nullptr != next)
-                    next->prev = prev;
-            }
-            delete node;
-            m_size--;
+            unlink(node, index);
             if (option == REMOVE_FIRST_OF) break;
-            else node = next;
         } else {
-            node = node->next;
+            index++;
         } 
+        node = next;
     }
 }
 
 template < typename T >
 auto LinkedList<T>::clear() -> void {
-    std::lock_guard<std::mutex> guard(m_mutex);
-    removeNodes(head);
+    std::lock_guard<SharedMutex> guard(m_mutex);
+    removeNodes(m_pool, head);
     head = nullptr;
     tail = nullptr;
     m_size = 0;
+    if (nullptr != m_index) m_index->clear();
 } 
 
 template < typename T >
 auto LinkedList<T>::popFront() -> void {
-    std::lock_guard<std::mutex> guard(m_mutex);
-    auto node = head;
-    if (nullptr != node) {
-        if (tail == node) tail = node->next;
-        head = node->next;
-        if (nullptr != head) head->prev = nullptr;
-        delete node;
-        m_size--;
-    }
+    std::lock_guard<SharedMutex> guard(m_mutex);
+    if (nullptr != head)
+        unlink(head, 0);
 }
 
 template < typename T >
 auto LinkedList<T>::popBack() -> void {
-    std::lock_guard<std::mutex> guard(m_mutex);
-    auto node = tail;
-    if (nullptr != node) {
-        tail = node->prev;
-        if (head == node) head = tail;
-        if (nullptr != tail) tail->next = nullptr;
-        delete node;
-        m_size--;
+    std::lock_guard<SharedMutex> guard(m_mutex);
+    if (nullptr != tail)
+        unlink(tail, m_size - 1);
+}
+
+template < typename T >
+template < typename InputIt >
+auto LinkedList<T>::addRange( InputIt first, InputIt last ) -> void {
+    NodePool<Node<T>> pool;
+    Node<T> *chainHead = nullptr,
+            *chainTail = nullptr;
+    std::size_t count = 0;
+    try {
+        for ( ; first != last; ++first, ++count ) {
+            auto node = emplaceNewNode(pool, static_cast<Node<T>*>(nullptr), chainTail, *first);
+            if (nullptr != chainTail) chainTail->next = node;
+            else chainHead = node;
+            chainTail = node;
+        }
+    } catch (...) {
+        removeNodes(pool, chainHead);
+        throw;
+    }
+    if (0 == count) return;
+    std::lock_guard<SharedMutex> guard(m_mutex);
+    m_pool.merge(pool);
+    linkChain(chainHead, chainTail, count);
+}
+
+template < typename T >
+auto LinkedList<T>::append( std::initializer_list<T> list ) -> void {
+    addRange(list.begin(), list.end());
+}
+
+template < typename T >
+auto LinkedList<T>::splice( LinkedList<T> &&other ) -> void {
+    if (this == &other) return;
+    std::lock(m_mutex, other.m_mutex);
+    std::lock_guard<SharedMutex> guard(m_mutex, std::adopt_lock);
+    std::lock_guard<SharedMutex> otherGuard(other.m_mutex, std::adopt_lock);
+    if (nullptr == other.head) return;
+    m_pool.merge(other.m_pool);
+    linkChain(other.head, other.tail, other.m_size);
+    other.head = other.tail = nullptr;
+    other.m_size = 0;
+    if (nullptr != other.m_index) other.m_index->clear();
+}
+
+template < typename T >
+auto LinkedList<T>::popFront( const std::size_t count ) -> std::size_t {
+    std::lock_guard<SharedMutex> guard(m_mutex);
+    const auto removed = (count < m_size) ? count : m_size;
+    if (removed == m_size) {
+        removeNodes(m_pool, head);
+        head = tail = nullptr;
+        m_size = 0;
+        if (nullptr != m_index) m_index->clear();
+        return removed;
+    }
+    for ( std::size_t i(0); i < removed; ++i )
+        unlink(head, 0);
+    return removed;
+}
+
+template < typename T >
+template < typename OutputIt >
+auto LinkedList<T>::drainTo( OutputIt out ) -> OutputIt {
+    NodePool<Node<T>> pool;
+    Node<T> *chain = nullptr;
+    {
+        std::lock_guard<SharedMutex> guard(m_mutex);
+        chain = head;
+        pool.merge(m_pool);
+        head = tail = nullptr;
+        m_size = 0;
+        if (nullptr != m_index) m_index->clear();
     }
+    try {
+        for ( auto node = chain; nullptr != node; node = node->next )
+            *out++ = std::move(node->data);
+    } catch (...) {
+        removeNodes(pool, chain);
+        throw;
+    }
+    removeNodes(pool, chain);
+    return out;
+}
+
+template < typename T >
+auto LinkedList<T>::linkChain( Node<T> *first, Node<T> *last, const std::size_t count ) -> void {
+    first->prev = tail;
+    if (nullptr != tail) tail->next = first;
+    else head = first;
+    tail = last;
+    if (nullptr != m_index) {
+        auto index = m_size;
+        for ( auto node = first; nullptr != node; node = node->next )
+            m_index->inserted(index++, node);
+    }
+    m_size += count;
 }
 
 template < typename T >
 auto LinkedList<T>::size() const -> std::size_t {
+    std::shared_lock<SharedMutex> guard(m_mutex);
     return m_size;
 }
 
 template < typename T >
 auto LinkedList<T>::empty() const -> bool {
+    std::shared_lock<SharedMutex> guard(m_mutex);
     return (m_size == 0);
 }
 
 template < typename T >
-auto LinkedList<T>::front() const -> T {
+auto LinkedList<T>::front() -> T& {
+    std::shared_lock<SharedMutex> guard(m_mutex);
+    if (nullptr == head) 
+        throw Exception("Access to a non allocated memory");
+    return head->data;
+}
+
+template < typename T >
+auto LinkedList<T>::front() const -> const T& {
+    std::shared_lock<SharedMutex> guard(m_mutex);
     if (nullptr == head) 
         throw Exception("Access to a non allocated memory");
     return head->data;
 }
 
 template < typename T >
-auto LinkedList<T>::back() const -> T {
+auto LinkedList<T>::back() -> T& {
+    std::shared_lock<SharedMutex> guard(m_mutex);
+    if (nullptr == tail) 
+        throw Exception("Access to a non allocated memory");
+    return tail->data;
+}
+
+template < typename T >
+auto LinkedList<T>::back() const -> const T& {
+    std::shared_lock<SharedMutex> guard(m_mutex);
     if (nullptr == tail) 
         throw Exception("Access to a non allocated memory");
     return tail->data;
@@ -322,18 +857,23 @@ auto LinkedList<T>::back() const -> T {
 
 template < typename T >
 auto LinkedList<T>::operator[] ( const std::size_t index ) -> T& {
+    std::shared_lock<SharedMutex> guard(m_mutex);
     if (index >= m_size)
         throw Exception("Index out of range");
-    auto node = head;
-    for ( auto i(0); i < index; ++i ) {
-        node = node->next;
-    }
-    return node->data;
+    return nodeAt(index)->data;
+}
+
+template < typename T >
+auto LinkedList<T>::operator[] ( const std::size_t index ) const -> const T& {
+    std::shared_lock<SharedMutex> guard(m_mutex);
+    if (index >= m_size)
+        throw Exception("Index out of range");
+    return nodeAt(index)->data;
 }
 
 template < typename T >
 auto LinkedList<T>::reverse() -> void {
-    std::lock_guard<std::mutex> guard(m_mutex);
+    std::lock_guard<SharedMutex> guard(m_mutex);
     auto node = head;
     tail = node;
     Node<T> *prev = nullptr;
@@ -346,63 +886,428 @@ auto LinkedList<T>::reverse() -> void {
         if (nullptr != next)
             head = next;
     }
+    if (nullptr != m_index) m_index->build(head, m_size);
+}
+
+template < typename T >
+auto LinkedList<T>::sort() -> void {
+    std::lock_guard<SharedMutex> guard(m_mutex);
+    sortNodes(std::integral_constant<bool, std::is_integral<T>::value && !std::is_same<T, bool>::value>());
 }
 
 template < typename T >
-auto LinkedList<T>::find( const T data ) const -> Iterator& {
-    for ( auto itr = begin(); itr != end(); ++itr ) {
-        if (itr->data == data)
-            return itr;
+template < typename Compare >
+auto LinkedList<T>::sort( Compare comp ) -> void {
+    std::lock_guard<SharedMutex> guard(m_mutex);
+    mergeSort(comp);
+}
+
+template < typename T >
+auto LinkedList<T>::sortNodes( std::true_type ) -> void {
+    if (m_size < 2) return;
+    using Key = typename std::make_unsigned<T>::type;
+    // flipping the sign bit orders signed values as unsigned keys
+    const Key flip = std::is_signed<T>::value ? static_cast<Key>(Key(1) << (8 * sizeof(T) - 1)) : Key(0);
+    Key differ = 0;
+    const Key first = static_cast<Key>(head->data);
+    for ( auto node = head; nullptr != node; node = node->next )
+        differ |= static_cast<Key>(node->data) ^ first;
+    auto chain = head;
+    for ( std::size_t shift(0); shift < 8 * sizeof(T); shift += 8 ) {
+        // bytes shared by every element do not change the order
+        if (0 == ((differ >> shift) & 0xFF)) continue;
+        Node<T> *bucketHead[256] = {}, *bucketTail[256] = {};
+        for ( auto node = chain; nullptr != node; node = node->next ) {
+            const auto byte = ((static_cast<Key>(node->data) ^ flip) >> shift) & 0xFF;
+            if (nullptr != bucketTail[byte]) bucketTail[byte]->next = node;
+            else bucketHead[byte] = node;
+            bucketTail[byte] = node;
+        }
+        Node<T> **link = &chain;
+        for ( std::size_t byte(0); byte < 256; ++byte ) {
+            if (nullptr == bucketHead[byte]) continue;
+            *link = bucketHead[byte];
+            link = &bucketTail[byte]->next;
+        }
+        *link = nullptr;
     }
+    relinkChain(chain);
 }
 
 template < typename T >
-auto LinkedList<T>::insert( const T data, Iterator &pos ) -> void {
-    std::lock_guard<std::mutex> guard(m_mutex);
-    auto current_node = pos.current_node;
-    if (nullptr == current_node)
+auto LinkedList<T>::sortNodes( std::false_type ) -> void {
+    std::less<T> comp;
+    mergeSort(comp);
+}
+
+template < typename T >
+template < typename Compare >
+auto LinkedList<T>::mergeSort( Compare &comp ) -> void {
+    if (m_size < 2) return;
+    // bins[i] holds a sorted run of 2^i nodes, older runs sit in higher bins
+    Node<T> *bins[64] = {};
+    auto node = head;
+    while (nullptr != node) {
+        auto next = node->next;
+        node->next = nullptr;
+        auto carry = node;
+        std::size_t i = 0;
+        for ( ; nullptr != bins[i]; ++i ) {
+            carry = mergeChains(bins[i], carry, comp);
+            bins[i] = nullptr;
+        }
+        bins[i] = carry;
+        node = next;
+    }
+    Node<T> *sorted = nullptr;
+    for ( auto bin : bins ) {
+        if (nullptr != bin) sorted = mergeChains(bin, sorted, comp);
+    }
+    relinkChain(sorted);
+}
+
+template < typename T >
+auto LinkedList<T>::unique() -> std::size_t {
+    return unique(std::equal_to<T>());
+}
+
+template < typename T >
+template < typename BinaryPredicate >
+auto LinkedList<T>::unique( BinaryPredicate pred ) -> std::size_t {
+    std::lock_guard<SharedMutex> guard(m_mutex);
+    const auto before = m_size;
+    if (nullptr == head) return 0;
+    std::size_t index = 1;
+    auto kept = head;
+    auto node = head->next;
+    while (nullptr != node) {
+        auto next = node->next;
+        if (pred(static_cast<const T&>(kept->data), static_cast<const T&>(node->data))) {
+            unlink(node, index);
+        } else {
+            kept = node;
+            index++;
+        }
+        node = next;
+    }
+    return before - m_size;
+}
+
+template < typename T >
+auto LinkedList<T>::merge( LinkedList<T> &other ) -> void {
+    merge(other, std::less<T>());
+}
+
+template < typename T >
+template < typename Compare >
+auto LinkedList<T>::merge( LinkedList<T> &other, Compare comp ) -> void {
+    if (this == &other) return;
+    std::lock(m_mutex, other.m_mutex);
+    std::lock_guard<SharedMutex> guard(m_mutex, std::adopt_lock);
+    std::lock_guard<SharedMutex> otherGuard(other.m_mutex, std::adopt_lock);
+    if (nullptr == other.head) return;
+    m_pool.merge(other.m_pool);
+    auto merged = mergeChains(head, other.head, comp);
+    m_size += other.m_size;
+    other.head = other.tail = nullptr;
+    other.m_size = 0;
+    if (nullptr != other.m_index) other.m_index->clear();
+    relinkChain(merged);
+}
+
+template < typename T >
+template < typename Predicate >
+auto LinkedList<T>::remove_if( Predicate pred, std::size_t threads ) -> std::size_t {
+    std::lock_guard<SharedMutex> guard(m_mutex);
+    const auto before = m_size;
+    std::vector<char> flags;
+    if (m_size > PARALLEL_MIN_CHUNK) {
+        flags.resize(m_size);
+        forEachChunk(threads, [&]( std::size_t, Node<T> *node, std::size_t offset, std::size_t count ) {
+            for ( auto i = offset; i < offset + count; ++i, node = node->next )
+                flags[i] = pred(static_cast<const T&>(node->data)) ? 1 : 0;
+        });
+    }
+    auto node = head;
+    std::size_t position = 0, index = 0;
+    while (nullptr != node) {
+        auto next = node->next;
+        const bool matches = flags.empty() ? static_cast<bool>(pred(static_cast<const T&>(node->data)))
+                                           : (0 != flags[position]);
+        if (matches) unlink(node, index);
+        else index++;
+        position++;
+        node = next;
+    }
+    return before - m_size;
+}
+
+template < typename T >
+template < typename Compare >
+auto LinkedList<T>::mergeChains( Node<T> *first, Node<T> *second, Compare &comp ) -> Node<T>* {
+    Node<T> *merged = nullptr;
+    Node<T> **link = &merged;
+    while (nullptr != first && nullptr != second) {
+        if (comp(static_cast<const T&>(second->data), static_cast<const T&>(first->data))) {
+            *link = second;
+            second = second->next;
+        } else {
+            *link = first;
+            first = first->next;
+        }
+        link = &(*link)->next;
+    }
+    *link = (nullptr != first) ? first : second;
+    return merged;
+}
+
+template < typename T >
+auto LinkedList<T>::relinkChain( Node<T> *first ) -> void {
+    head = first;
+    Node<T> *prev = nullptr;
+    for ( auto node = first; nullptr != node; node = node->next ) {
+        node->prev = prev;
+        prev = node;
+    }
+    tail = prev;
+    if (nullptr != m_index) m_index->build(head, m_size);
+}
+
+template < typename T >
+auto LinkedList<T>::find( const T &data ) -> Iterator {
+    std::shared_lock<SharedMutex> guard(m_mutex);
+    auto node = head;
+    while (nullptr != node && !(node->data == data))
+        node = node->next;
+    return Iterator(node, this);
+}
+
+template < typename T >
+auto LinkedList<T>::find( const T &data ) const -> ConstIterator {
+    std::shared_lock<SharedMutex> guard(m_mutex);
+    auto node = head;
+    while (nullptr != node && !(node->data == data))
+        node = node->next;
+    return ConstIterator(node, this);
+}
+
+template < typename T >
+auto LinkedList<T>::insert( const T &data, const Iterator &pos ) -> void {
+    if (this != pos.m_list)
         throw Exception("Access to a non allocated memory");
-    if (current_node == tail) {
-        add(data);
+    std::lock_guard<SharedMutex> guard(m_mutex);
+    auto current_node = pos.current_node;
+    if (nullptr == current_node || current_node == tail) {
+        linkAfter(tail, m_size, data);
     } else if (current_node == head) {
-        addFront(data);
+        linkAfter(nullptr, 0, data);
     } else {
-        auto new_node = createNewNode(data, current_node->next, current_node->prev);
-        current_node->next = new_node;
-        auto next = new_node->next;
-        if (nullptr != next)
-            next->prev = new_node;
-        m_size++;
+        const auto index = (nullptr != m_index) ? positionOf(current_node) + 1 : 0;
+        linkAfter(current_node, index, data);
     }
 }
 
 template < typename T >
-auto LinkedList<T>::begin() -> Iterator& {
-    itr.current_node = head;
-    return itr;
+auto LinkedList<T>::insert( const T &data, const std::size_t index ) -> void {
+    emplace(index, data);
 }
 
 template < typename T >
-auto LinkedList<T>::end() -> Iterator& {
-    itr.current_node = tail;
-    return itr;
+auto LinkedList<T>::enableIndex() -> void {
+    std::lock_guard<SharedMutex> guard(m_mutex);
+    if (nullptr == m_index) {
+        m_index = new SkipIndex<T>();
+        m_index->build(head, m_size);
+    }
 }
 
 template < typename T >
-auto LinkedList<T>::Iterator::operator++() -> Iterator& {
+auto LinkedList<T>::disableIndex() -> void {
+    std::lock_guard<SharedMutex> guard(m_mutex);
+    delete m_index;
+    m_index = nullptr;
+}
+
+template < typename T >
+auto LinkedList<T>::indexed() const -> bool {
+    std::shared_lock<SharedMutex> guard(m_mutex);
+    return (nullptr != m_index);
+}
+
+template < typename T >
+auto LinkedList<T>::readLock() const -> std::shared_lock<SharedMutex> {
+    return std::shared_lock<SharedMutex>(m_mutex);
+}
+
+template < typename T >
+auto LinkedList<T>::begin() -> Iterator {
+    return Iterator(head, this);
+}
+
+template < typename T >
+auto LinkedList<T>::begin() const -> ConstIterator {
+    return ConstIterator(head, this);
+}
+
+template < typename T >
+auto LinkedList<T>::cbegin() const -> ConstIterator {
+    return ConstIterator(head, this);
+}
+
+template < typename T >
+auto LinkedList<T>::end() -> Iterator {
+    return Iterator(nullptr, this);
+}
+
+template < typename T >
+auto LinkedList<T>::end() const -> ConstIterator {
+    return ConstIterator(nullptr, this);
+}
+
+template < typename T >
+auto LinkedList<T>::cend() const -> ConstIterator {
+    return ConstIterator(nullptr, this);
+}
+
+template < typename T >
+template < typename Function >
+auto LinkedList<T>::parallelForEach( Function function, std::size_t threads ) -> void {
+    std::lock_guard<SharedMutex> guard(m_mutex);
+    forEachChunk(threads, [&function]( std::size_t, Node<T> *node, std::size_t, std::size_t count ) {
+        for ( ; count > 0; --count, node = node->next )
+            function(node->data);
+    });
+}
+
+template < typename T >
+template < typename R, typename Accumulate, typename Combine >
+auto LinkedList<T>::parallelReduce( R init, Accumulate accumulate, Combine combine, std::size_t threads ) const -> R {
+    // wrapped so that std::vector<bool> never packs partials of two threads
+    struct Partial { R value; };
+    std::shared_lock<SharedMutex> guard(m_mutex);
+    std::vector<Partial> partials(PARALLEL_MAX_THREADS, Partial{init});
+    const auto chunks = forEachChunk(threads, [&]( std::size_t chunk, Node<T> *node, std::size_t, std::size_t count ) {
+        R value = init;
+        for ( ; count > 0; --count, node = node->next )
+            value = accumulate(std::move(value), static_cast<const T&>(node->data));
+        partials[chunk].value = std::move(value);
+    });
+    for ( std::size_t chunk(0); chunk < chunks; ++chunk )
+        init = combine(std::move(init), std::move(partials[chunk].value));
+    return init;
+}
+
+template < typename T >
+template < typename Task >
+auto LinkedList<T>::forEachChunk( std::size_t threads, Task task ) const -> std::size_t {
+    if (0 == m_size) return 0;
+    if (0 == threads) threads = std::thread::hardware_concurrency();
+    if (threads > PARALLEL_MAX_THREADS) threads = PARALLEL_MAX_THREADS;
+    const auto bySize = (m_size + PARALLEL_MIN_CHUNK - 1) / PARALLEL_MIN_CHUNK;
+    const auto chunks = std::max<std::size_t>(1, std::min(threads, bySize));
+    // the only sequential part is one walk to find where each chunk starts
+    Node<T> *starts[PARALLEL_MAX_THREADS];
+    std::size_t offsets[PARALLEL_MAX_THREADS], counts[PARALLEL_MAX_THREADS];
+    auto node = head;
+    for ( std::size_t chunk(0); chunk < chunks; ++chunk ) {
+        starts[chunk] = node;
+        offsets[chunk] = (0 == chunk) ? 0 : offsets[chunk - 1] + counts[chunk - 1];
+        counts[chunk] = m_size / chunks + ((chunk < m_size % chunks) ? 1 : 0);
+        for ( std::size_t i(0); i < counts[chunk] && chunk + 1 < chunks; ++i )
+            node = node->next;
+    }
+    std::exception_ptr errors[PARALLEL_MAX_THREADS];
+    std::vector<std::thread> workers;
+    workers.reserve(chunks - 1);
+    for ( std::size_t chunk(1); chunk < chunks; ++chunk ) {
+        workers.emplace_back([&, chunk]() {
+            try {
+                task(chunk, starts[chunk], offsets[chunk], counts[chunk]);
+            } catch (...) {
+                errors[chunk] = std::current_exception();
+            }
+        });
+    }
+    try {
+        task(0, starts[0], offsets[0], counts[0]);
+    } catch (...) {
+        errors[0] = std::current_exception();
+    }
+    for ( auto &worker : workers )
+        worker.join();
+    for ( std::size_t chunk(0); chunk < chunks; ++chunk ) {
+        if (errors[chunk]) std::rethrow_exception(errors[chunk]);
+    }
+    return chunks;
+}
+
+template < typename T >
+template < bool IsConst >
+LinkedList<T>::BasicIterator<IsConst>::BasicIterator( Node<T> *node, const LinkedList<T> *list ) :
+    current_node(node), m_list(list) {
+}
+
+template < typename T >
+template < bool IsConst >
+template < bool WasConst, typename >
+LinkedList<T>::BasicIterator<IsConst>::BasicIterator( const BasicIterator<WasConst> &other ) :
+    current_node(other.current_node), m_list(other.m_list) {
+}
+
+template < typename T >
+template < bool IsConst >
+auto LinkedList<T>::BasicIterator<IsConst>::operator++() -> BasicIterator& {
     current_node = current_node->next;
     return *this;
 }
 
 template < typename T >
-auto LinkedList<T>::Iterator::operator--() -> Iterator& {
-    current_node = current_node->prev;
+template < bool IsConst >
+auto LinkedList<T>::BasicIterator<IsConst>::operator++( int ) -> BasicIterator {
+    auto previous = *this;
+    current_node = current_node->next;
+    return previous;
+}
+
+template < typename T >
+template < bool IsConst >
+auto LinkedList<T>::BasicIterator<IsConst>::operator--() -> BasicIterator& {
+    current_node = (nullptr != current_node) ? current_node->prev : m_list->tail;
     return *this;
 }
 
 template < typename T >
-auto LinkedList<T>::Iterator::operator->() -> Node<T>* {
-    return current_node;
+template < bool IsConst >
+auto LinkedList<T>::BasicIterator<IsConst>::operator--( int ) -> BasicIterator {
+    auto previous = *this;
+    --(*this);
+    return previous;
+}
+
+template < typename T >
+template < bool IsConst >
+auto LinkedList<T>::BasicIterator<IsConst>::operator*() const -> reference {
+    return current_node->data;
+}
+
+template < typename T >
+template < bool IsConst >
+auto LinkedList<T>::BasicIterator<IsConst>::operator->() const -> pointer {
+    return &current_node->data;
+}
+
+template < typename T >
+template < bool IsConst >
+template < bool OtherConst >
+auto LinkedList<T>::BasicIterator<IsConst>::operator==( const BasicIterator<OtherConst> &other ) const -> bool {
+    return current_node == other.current_node;
+}
+
+template < typename T >
+template < bool IsConst >
+template < bool OtherConst >
+auto LinkedList<T>::BasicIterator<IsConst>::operator!=( const BasicIterator<OtherConst> &other ) const -> bool {
+    return current_node != other.current_node;
 }
 
 #endif
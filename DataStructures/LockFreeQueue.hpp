@@ -0,0 +1,226 @@
+/** @file LockFreeQueue.hpp
+ *  @brief Class definition of a lock-free linked queue
+ *
+ *  LockFreeQueue is the lock-free alternative to LinkedList for
+ *  the append / pop front pattern with many producers and many
+ *  consumers (Michael-Scott queue). Dequeued nodes are reclaimed
+ *  through hazard pointers.
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+#ifndef LOCKFREEQUEUE_HPP_
+#define LOCKFREEQUEUE_HPP_
+
+/******************************
+ *     std includes
+*******************************/
+#include <atomic>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/******************************
+ *    internal includes
+*******************************/
+#include "../Misc/constants.hpp"
+#include "../Misc/HazardPointer.hpp"
+
+template < typename T >
+/** @class LockFreeQueue
+ *  @brief This class define a lock-free multi producer
+ *         multi consumer queue of any data type whose move
+ *         assignment does not throw.
+ */
+class LockFreeQueue final {
+    // popFront moves the element out after unlinking it, a throw would lose it
+    static_assert(std::is_nothrow_move_assignable<T>::value, "T must be nothrow move assignable");
+public:
+    /***************************************************************************//**
+    * @brief : Constructor
+    *
+    * @param : none
+    ******************************************************************************/
+    LockFreeQueue();
+    /***************************************************************************//**
+    * @brief : Destructor, must not run concurrently with other operations
+    *
+    * @param : none
+    ******************************************************************************/
+    ~LockFreeQueue();
+    LockFreeQueue( const LockFreeQueue & ) = delete;
+    auto operator=( const LockFreeQueue & ) -> LockFreeQueue& = delete;
+    /***************************************************************************//**
+    * @brief : Append a new element to the queue
+    *
+    * @param in: data  - const T type
+    ******************************************************************************/
+    auto add( const T &data ) -> void;
+    /***************************************************************************//**
+    * @brief : Append a new element to the queue, data is moved
+    *
+    * @param in: data  - T rvalue
+    ******************************************************************************/
+    auto add( T &&data ) -> void;
+    /***************************************************************************//**
+    * @brief : Construct a new element in place at the end of the queue
+    *
+    * @param in: args  - arguments forwarded to the constructor of T
+    ******************************************************************************/
+    template < typename... Args >
+    auto emplace( Args&&... args ) -> void;
+    /***************************************************************************//**
+    * @brief : Remove the first element of the queue
+    *
+    * @param out: data - receives the first element
+    * @return   : bool - false if the queue was empty
+    ******************************************************************************/
+    auto popFront( T &data ) -> bool;
+    /***************************************************************************//**
+    * @brief  : get number of elements, exact only when the queue is quiescent
+    *
+    * @param  :  none
+    * @return :  std::size_t - number of elements
+    ******************************************************************************/
+    auto size() const -> std::size_t;
+    /***************************************************************************//**
+    * @brief  : check if the queue is empty
+    *
+    * @param  :  none
+    * @return :  bool - true if no element is queued
+    ******************************************************************************/
+    auto empty() const -> bool;
+private:
+    /** @struct QueueNode
+     *  @brief Queue link, data is constructed only in nodes after the head
+     */
+    struct QueueNode {
+        std::atomic<QueueNode*> next {nullptr};
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+
+        auto data() -> T& { return *reinterpret_cast<T*>(&storage); }
+    }; // struct QueueNode
+
+    alignas(CACHE_LINE_SIZE) std::atomic<QueueNode*> m_head {nullptr};
+    alignas(CACHE_LINE_SIZE) std::atomic<QueueNode*> m_tail {nullptr};
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> m_size {0};
+    /***************************************************************************//**
+    * @brief : Link a node holding constructed data at the end of the queue
+    *
+    * @param in: node - node to publish
+    ******************************************************************************/
+    auto link( QueueNode *node ) -> void;
+}; // class LockFreeQueue
+/***********************************************************
+ *                Functions definition
+************************************************************/
+template < typename T >
+LockFreeQueue<T>::LockFreeQueue() {
+    auto dummy = new QueueNode();
+    m_head.store(dummy, std::memory_order_relaxed);
+    m_tail.store(dummy, std::memory_order_relaxed);
+}
+
+template < typename T >
+LockFreeQueue<T>::~LockFreeQueue() {
+    auto node = m_head.load(std::memory_order_relaxed);
+    auto next = node->next.load(std::memory_order_relaxed);
+    delete node;
+    while (nullptr != next) {
+        node = next;
+        next = node->next.load(std::memory_order_relaxed);
+        node->data().~T();
+        delete node;
+    }
+}
+
+template < typename T >
+auto LockFreeQueue<T>::add( const T &data ) -> void {
+    emplace(data);
+}
+
+template < typename T >
+auto LockFreeQueue<T>::add( T &&data ) -> void {
+    emplace(std::move(data));
+}
+
+template < typename T >
+template < typename... Args >
+auto LockFreeQueue<T>::emplace( Args&&... args ) -> void {
+    auto node = new QueueNode();
+    try {
+        ::new (static_cast<void*>(&node->storage)) T(std::forward<Args>(args)...);
+    } catch (...) {
+        delete node;
+        throw;
+    }
+    link(node);
+}
+
+template < typename T >
+auto LockFreeQueue<T>::link( QueueNode *node ) -> void {
+    // counted before linking so that a concurrent pop never drives it below zero
+    m_size.fetch_add(1, std::memory_order_relaxed);
+    HazardPointer hazard(0);
+    while (true) {
+        auto tail = hazard.protect(m_tail);
+        auto next = tail->next.load(std::memory_order_acquire);
+        if (tail != m_tail.load(std::memory_order_acquire)) continue;
+        if (nullptr != next) {
+            // tail is lagging behind, help the other producer
+            m_tail.compare_exchange_weak(tail, next, std::memory_order_release,
+                                                     std::memory_order_relaxed);
+            continue;
+        }
+        QueueNode *expected = nullptr;
+        if (tail->next.compare_exchange_weak(expected, node, std::memory_order_release,
+                                                             std::memory_order_relaxed)) {
+            m_tail.compare_exchange_strong(tail, node, std::memory_order_release,
+                                                       std::memory_order_relaxed);
+            break;
+        }
+    }
+}
+
+template < typename T >
+auto LockFreeQueue<T>::popFront( T &data ) -> bool {
+    HazardPointer hazardHead(0), hazardNext(1);
+    while (true) {
+        auto head = hazardHead.protect(m_head);
+        auto tail = m_tail.load(std::memory_order_acquire);
+        auto next = hazardNext.protect(head->next);
+        if (head != m_head.load(std::memory_order_acquire)) continue;
+        if (nullptr == next) return false;
+        if (head == tail) {
+            m_tail.compare_exchange_weak(tail, next, std::memory_order_release,
+                                                     std::memory_order_relaxed);
+            continue;
+        }
+        auto expected = head;
+        if (m_head.compare_exchange_strong(expected, next, std::memory_order_acq_rel,
+                                                           std::memory_order_relaxed)) {
+            // next is the new dummy, only the winner touches its data
+            data = std::move(next->data());
+            next->data().~T();
+            hazardNext.reset();
+            hazardHead.reset();
+            retireNode(head);
+            m_size.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+}
+
+template < typename T >
+auto LockFreeQueue<T>::size() const -> std::size_t {
+    return m_size.load(std::memory_order_relaxed);
+}
+
+template < typename T >
+auto LockFreeQueue<T>::empty() const -> bool {
+    HazardPointer hazard(0);
+    auto head = hazard.protect(m_head);
+    return nullptr == head->next.load(std::memory_order_acquire);
+}
+
+#endif
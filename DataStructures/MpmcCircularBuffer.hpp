@@ -0,0 +1,342 @@
+/** @file MpmcCircularBuffer.hpp
+ *  @brief Class definition of a bounded multi producer multi consumer
+ *         circular buffer
+ *
+ *  Every slot carries a sequence number telling whether it waits for
+ *  a producer or for a consumer of a given lap (D. Vyukov's bounded
+ *  queue). Producers and consumers claim positions with a CAS on
+ *  their own counter and then only touch their slot, so no lock is
+ *  taken. A full buffer applies backpressure: try_put fails, put
+ *  waits and put_for waits up to a timeout, the way they wait is
+ *  chosen by the Wait strategy.
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+#ifndef MPMCCIRCULARBUFFER_HPP_
+#define MPMCCIRCULARBUFFER_HPP_
+
+/***********************************************************
+ *                   std includes
+***********************************************************/
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/***********************************************************
+ *                 internal includes
+***********************************************************/
+#include "../Misc/constants.hpp"
+#include "../Misc/WaitStrategy.hpp"
+
+template < typename T, std::size_t size, typename Wait = SpinYieldWait >
+/** @class MpmcCircularBuffer
+ *  @brief This class define a bounded buffer shared by any number of
+ *         producer and consumer threads. T must be nothrow move
+ *         constructible and assignable so that a claimed slot is
+ *         always filled and always emptied.
+ */
+class MpmcCircularBuffer final {
+    // with one cell a filled slot, sequence position + 1, reads as empty to
+    // the producer of the next lap, position + size, which overwrites it
+    static_assert(size >= 2, "The sequence scheme needs at least two cells");
+    static_assert(std::is_nothrow_move_constructible<T>::value, "T must be nothrow move constructible");
+    static_assert(std::is_nothrow_move_assignable<T>::value, "T must be nothrow move assignable");
+public:
+    /***************************************************************************//**
+    * @brief : Constructor
+    *
+    * @param : none
+    ******************************************************************************/
+    MpmcCircularBuffer();
+    /***************************************************************************//**
+    * @brief : Destructor, destroys the elements left in the buffer
+    *
+    * @param : none
+    ******************************************************************************/
+    ~MpmcCircularBuffer();
+    MpmcCircularBuffer( const MpmcCircularBuffer & ) = delete;
+    auto operator=( const MpmcCircularBuffer & ) -> MpmcCircularBuffer& = delete;
+    /***************************************************************************//**
+    * @brief : add an element to buffer without waiting
+    *
+    * @param in : input - const T or T rvalue, left untouched on failure
+    * @return   : false if the buffer is full
+    ******************************************************************************/
+    auto try_put( const T &input ) -> bool;
+    auto try_put( T &&input ) -> bool;
+    /***************************************************************************//**
+    * @brief : construct an element and add it to buffer without waiting
+    *
+    * @param in : args - arguments forwarded to the constructor of T
+    * @return   : false if the buffer is full, nothing is constructed then
+    ******************************************************************************/
+    template < typename... Args >
+    auto try_emplace( Args&&... args ) -> bool;
+    /***************************************************************************//**
+    * @brief : remove the oldest element without waiting
+    *
+    * @param out : output - receives the element
+    * @return    : false if the buffer is empty
+    ******************************************************************************/
+    auto try_get( T &output ) -> bool;
+    /***************************************************************************//**
+    * @brief : add an element to buffer, waits while the buffer is full
+    *
+    * @param in : input - const T or T rvalue
+    ******************************************************************************/
+    auto put( const T &input ) -> void;
+    auto put( T &&input ) -> void;
+    /***************************************************************************//**
+    * @brief : remove the oldest element, waits while the buffer is empty
+    *
+    * @param out : output - receives the element
+    ******************************************************************************/
+    auto get( T &output ) -> void;
+    /***************************************************************************//**
+    * @brief : add an element to buffer, waits up to timeout while the buffer
+    *          is full
+    *
+    * @param in : input   - const T or T rvalue, left untouched on failure
+    * @param in : timeout - longest wait
+    * @return   : false if the buffer stayed full
+    ******************************************************************************/
+    template < typename Rep, typename Period >
+    auto put_for( const T &input, const std::chrono::duration<Rep, Period> &timeout ) -> bool;
+    template < typename Rep, typename Period >
+    auto put_for( T &&input, const std::chrono::duration<Rep, Period> &timeout ) -> bool;
+    /***************************************************************************//**
+    * @brief : remove the oldest element, waits up to timeout while the
+    *          buffer is empty
+    *
+    * @param out: output  - receives the element
+    * @param in : timeout - longest wait
+    * @return   : false if the buffer stayed empty
+    ******************************************************************************/
+    template < typename Rep, typename Period >
+    auto get_for( T &output, const std::chrono::duration<Rep, Period> &timeout ) -> bool;
+    /***************************************************************************//**
+    * @brief : Number of elements, a snapshot while other threads run
+    *
+    * @param  : none
+    * @return : std::size_t - number of elements
+    ******************************************************************************/
+    auto count() const -> std::size_t;
+    /***************************************************************************//**
+    * @brief : Verify if the buffer is empty
+    *
+    * @param  : none
+    * @return : Return true if count() is 0
+    ******************************************************************************/
+    auto empty() const -> bool;
+private:
+    /** @struct Cell
+     *  @brief Slot of the ring. sequence equals the position a producer
+     *         may fill, or that position plus one once it is readable.
+     */
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type data;
+    }; // struct Cell
+    static constexpr bool POWER_OF_TWO = (0 == (size & (size - 1)));
+
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> m_enqueuePos {0};
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> m_dequeuePos {0};
+    alignas(CACHE_LINE_SIZE) Cell m_cells[size];
+    Wait m_wait;
+    /***************************************************************************//**
+    * @brief : Cell of a position
+    *
+    * @param in : position - enqueue or dequeue counter
+    * @return   : the cell
+    ******************************************************************************/
+    auto cell( const std::size_t position ) -> Cell&;
+    auto cell( const std::size_t position ) const -> const Cell&;
+    /***************************************************************************//**
+    * @brief : Claim a position and move value in its cell
+    *
+    * @param in : value - element to move, untouched on failure
+    * @return   : false if the buffer is full
+    ******************************************************************************/
+    auto push( T &value ) -> bool;
+    /***************************************************************************//**
+    * @brief : Check if a producer may fill the next position, or if a
+    *          consumer may read the next position
+    *
+    * @param  : none
+    * @return : true if a try_put (try_get) is worth retrying
+    ******************************************************************************/
+    auto writable() const -> bool;
+    auto readable() const -> bool;
+}; // class MpmcCircularBuffer
+/***********************************************************
+ *                Functions definition
+************************************************************/
+template < typename T, std::size_t size, typename Wait >
+MpmcCircularBuffer<T, size, Wait>::MpmcCircularBuffer() {
+    for ( std::size_t i(0); i < size; ++i )
+        m_cells[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+template < typename T, std::size_t size, typename Wait >
+MpmcCircularBuffer<T, size, Wait>::~MpmcCircularBuffer() {
+    const auto tail = m_enqueuePos.load(std::memory_order_relaxed);
+    for ( auto head = m_dequeuePos.load(std::memory_order_relaxed); head != tail; ++head )
+        reinterpret_cast<T*>(&cell(head).data)->~T();
+}
+
+template < typename T, std::size_t size, typename Wait >
+auto MpmcCircularBuffer<T, size, Wait>::try_put( const T &input ) -> bool {
+    if (!writable()) return false;
+    T value(input);
+    return push(value);
+}
+
+template < typename T, std::size_t size, typename Wait >
+auto MpmcCircularBuffer<T, size, Wait>::try_put( T &&input ) -> bool {
+    return push(input);
+}
+
+template < typename T, std::size_t size, typename Wait >
+template < typename... Args >
+auto MpmcCircularBuffer<T, size, Wait>::try_emplace( Args&&... args ) -> bool {
+    if (!writable()) return false;
+    T value(std::forward<Args>(args)...);
+    return push(value);
+}
+
+template < typename T, std::size_t size, typename Wait >
+auto MpmcCircularBuffer<T, size, Wait>::try_get( T &output ) -> bool {
+    auto position = m_dequeuePos.load(std::memory_order_relaxed);
+    Cell *slot = nullptr;
+    while (true) {
+        slot = &cell(position);
+        const auto sequence = slot->sequence.load(std::memory_order_acquire);
+        const auto lag = static_cast<std::intptr_t>(sequence - (position + 1));
+        if (0 == lag) {
+            if (m_dequeuePos.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                break;
+        } else if (lag < 0) {
+            return false;
+        } else {
+            position = m_dequeuePos.load(std::memory_order_relaxed);
+        }
+    }
+    auto item = reinterpret_cast<T*>(&slot->data);
+    output = std::move(*item);
+    item->~T();
+    slot->sequence.store(position + size, std::memory_order_release);
+    m_wait.notify();
+    return true;
+}
+
+template < typename T, std::size_t size, typename Wait >
+auto MpmcCircularBuffer<T, size, Wait>::put( const T &input ) -> void {
+    T value(input);
+    while (!push(value))
+        m_wait.wait([this]() { return writable(); });
+}
+
+template < typename T, std::size_t size, typename Wait >
+auto MpmcCircularBuffer<T, size, Wait>::put( T &&input ) -> void {
+    while (!push(input))
+        m_wait.wait([this]() { return writable(); });
+}
+
+template < typename T, std::size_t size, typename Wait >
+auto MpmcCircularBuffer<T, size, Wait>::get( T &output ) -> void {
+    while (!try_get(output))
+        m_wait.wait([this]() { return readable(); });
+}
+
+template < typename T, std::size_t size, typename Wait >
+template < typename Rep, typename Period >
+auto MpmcCircularBuffer<T, size, Wait>::put_for( const T &input, const std::chrono::duration<Rep, Period> &timeout ) -> bool {
+    T value(input);
+    return put_for(std::move(value), timeout);
+}
+
+template < typename T, std::size_t size, typename Wait >
+template < typename Rep, typename Period >
+auto MpmcCircularBuffer<T, size, Wait>::put_for( T &&input, const std::chrono::duration<Rep, Period> &timeout ) -> bool {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!push(input)) {
+        if (!m_wait.waitUntil([this]() { return writable(); }, deadline)) return false;
+    }
+    return true;
+}
+
+template < typename T, std::size_t size, typename Wait >
+template < typename Rep, typename Period >
+auto MpmcCircularBuffer<T, size, Wait>::get_for( T &output, const std::chrono::duration<Rep, Period> &timeout ) -> bool {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!try_get(output)) {
+        if (!m_wait.waitUntil([this]() { return readable(); }, deadline)) return false;
+    }
+    return true;
+}
+
+template < typename T, std::size_t size, typename Wait >
+auto MpmcCircularBuffer<T, size, Wait>::count() const -> std::size_t {
+    const auto head = m_dequeuePos.load(std::memory_order_acquire);
+    const auto tail = m_enqueuePos.load(std::memory_order_acquire);
+    return (tail > head) ? tail - head : 0;
+}
+
+template < typename T, std::size_t size, typename Wait >
+auto MpmcCircularBuffer<T, size, Wait>::empty() const -> bool {
+    return (0 == count());
+}
+
+template < typename T, std::size_t size, typename Wait >
+auto MpmcCircularBuffer<T, size, Wait>::cell( const std::size_t position ) -> Cell& {
+    return m_cells[POWER_OF_TWO ? (position & (size - 1)) : (position % size)];
+}
+
+template < typename T, std::size_t size, typename Wait >
+auto MpmcCircularBuffer<T, size, Wait>::cell( const std::size_t position ) const -> const Cell& {
+    return m_cells[POWER_OF_TWO ? (position & (size - 1)) : (position % size)];
+}
+
+template < typename T, std::size_t size, typename Wait >
+auto MpmcCircularBuffer<T, size, Wait>::push( T &value ) -> bool {
+    auto position = m_enqueuePos.load(std::memory_order_relaxed);
+    Cell *slot = nullptr;
+    while (true) {
+        slot = &cell(position);
+        const auto sequence = slot->sequence.load(std::memory_order_acquire);
+        const auto lag = static_cast<std::intptr_t>(sequence - position);
+        if (0 == lag) {
+            if (m_enqueuePos.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                break;
+        } else if (lag < 0) {
+            return false;
+        } else {
+            position = m_enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+    new (&slot->data) T(std::move(value));
+    slot->sequence.store(position + 1, std::memory_order_release);
+    m_wait.notify();
+    return true;
+}
+
+template < typename T, std::size_t size, typename Wait >
+auto MpmcCircularBuffer<T, size, Wait>::writable() const -> bool {
+    const auto position = m_enqueuePos.load(std::memory_order_relaxed);
+    const auto sequence = cell(position).sequence.load(std::memory_order_acquire);
+    return static_cast<std::intptr_t>(sequence - position) >= 0;
+}
+
+template < typename T, std::size_t size, typename Wait >
+auto MpmcCircularBuffer<T, size, Wait>::readable() const -> bool {
+    const auto position = m_dequeuePos.load(std::memory_order_relaxed);
+    const auto sequence = cell(position).sequence.load(std::memory_order_acquire);
+    return static_cast<std::intptr_t>(sequence - (position + 1)) >= 0;
+}
+
+#endif
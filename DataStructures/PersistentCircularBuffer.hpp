@@ -0,0 +1,376 @@
+/** @file PersistentCircularBuffer.hpp
+ *  @brief Class definition of a circular buffer kept in a file
+ *
+ *  The buffer is a memory mapped file: a header holding the head and
+ *  tail sequence numbers followed by size fixed records. A record
+ *  stores its sequence number, the element and a CRC-32 of both, so
+ *  a put is a copy into the mapping and the file survives a crash of
+ *  the process. Reopening the file trusts the header and only checks
+ *  the records put after its last update, at most the records the
+ *  crash interrupted. A record torn by a crash of the machine fails
+ *  its checksum and is skipped when read. When the mapping reaches
+ *  the disk is the SYNC_ENUM policy given to the constructor.
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+#ifndef PERSISTENTCIRCULARBUFFER_HPP_
+#define PERSISTENTCIRCULARBUFFER_HPP_
+
+/***********************************************************
+ *                   std includes
+***********************************************************/
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string>
+#include <type_traits>
+
+/***********************************************************
+ *                   system includes
+***********************************************************/
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/***********************************************************
+ *                 internal includes
+***********************************************************/
+#include "../Misc/constants.hpp"
+#include "../Misc/Crc32.hpp"
+#include "../Misc/Exception.hpp"
+
+/** @enum SYNC_ENUM
+*   @brief when a persistent circular buffer writes its mapping to disk
+*/
+enum SYNC_ENUM
+{
+    SYNC_NONE = 0,      // left to the kernel and flush()
+    SYNC_PERIODIC,      // asynchronous writeback started every interval puts
+    SYNC_ALWAYS         // every put waits for its record to reach the disk
+}; // enum SYNC_ENUM
+
+template < typename T, std::size_t size >
+/** @class PersistentCircularBuffer
+ *  @brief This class define a circular buffer of a fixed size stored in
+ *         a file. Once full, each put overwrites the oldest element.
+ *         Not synchronized, one process opens the file at a time.
+ */
+class PersistentCircularBuffer final {
+    static_assert(size > 0, "A circular buffer holds at least one element");
+    static_assert(std::is_trivially_copyable<T>::value, "Persistent elements are copied as bytes");
+public:
+    /***************************************************************************//**
+    * @brief : Constructor, creates the file or recovers the buffer it holds
+    *
+    * @param in: path     - file of the buffer
+    * @param in: sync     - when the mapping is written to disk
+    * @param in: interval - puts between two writebacks with SYNC_PERIODIC
+    ******************************************************************************/
+    PersistentCircularBuffer( const std::string &path, SYNC_ENUM sync = SYNC_NONE,
+                              std::size_t interval = PERSISTENT_SYNC_INTERVAL );
+    /***************************************************************************//**
+    * @brief : Destructor, flushes and unmaps the file
+    *
+    * @param : none
+    ******************************************************************************/
+    ~PersistentCircularBuffer();
+    PersistentCircularBuffer( const PersistentCircularBuffer & ) = delete;
+    auto operator=( const PersistentCircularBuffer & ) -> PersistentCircularBuffer& = delete;
+    /***************************************************************************//**
+    * @brief : add an element to buffer
+    *
+    * @param in : input - const T
+    ******************************************************************************/
+    auto put( const T &input ) -> void;
+    /***************************************************************************//**
+    * @brief : remove the oldest valid element, torn records are dropped
+    *
+    * @param out : output - receives the element
+    * @return    : false if the buffer holds no valid element
+    ******************************************************************************/
+    auto get( T &output ) -> bool;
+    /***************************************************************************//**
+    * @brief : Remove all elements in current buffer
+    *
+    * @param : none
+    ******************************************************************************/
+    auto removeAll() -> void;
+    /***************************************************************************//**
+    * @brief : Wait until the mapping is on disk
+    *
+    * @param : none
+    ******************************************************************************/
+    auto flush() -> void;
+    /***************************************************************************//**
+    * @brief : Verify if the record at a position passes its checksum
+    *
+    * @param in:  index position, 0 is the oldest element
+    * @return  :  false if the record was torn by a crash
+    ******************************************************************************/
+    auto valid( const std::size_t index ) const -> bool;
+    /***************************************************************************//**
+    * @brief : Index operator, throws if the record fails its checksum
+    *
+    * @param in:  index position, 0 is the oldest element
+    * @return  :  copy of the element at position index
+    ******************************************************************************/
+    auto operator[] ( const std::size_t index ) const -> T;
+    /***************************************************************************//**
+    * @brief : Sequence number of an element, the number of puts made
+    *          before it since the file was created
+    *
+    * @param in:  index position, 0 is the oldest element
+    * @return  :  std::uint64_t - sequence number
+    ******************************************************************************/
+    auto sequence( const std::size_t index ) const -> std::uint64_t;
+    /***************************************************************************//**
+    * @brief : Verify if circular buffer is empty or not
+    *
+    * @param  : none
+    * @return : Return true if circular buffer is empty
+    ******************************************************************************/
+    auto empty() const -> bool;
+    /***************************************************************************//**
+    * @brief : Number of elements in current buffer, torn records included
+    *
+    * @param  : none
+    * @return : std::size_t - number of elements, at most size
+    ******************************************************************************/
+    auto count() const -> std::size_t;
+private:
+    static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "Persistent counters must be lock-free");
+    static constexpr std::uint64_t MAGIC = 0x5043495243425546ULL;
+    /** @struct Header
+     *  @brief Start of the file, the records follow it
+     */
+    struct Header {
+        std::uint64_t magic;
+        std::uint64_t recordSize;
+        std::uint64_t capacity;
+        std::atomic<std::uint64_t> head;
+        std::atomic<std::uint64_t> tail;
+    }; // struct Header
+    /** @struct Record
+     *  @brief Slot of the file, the checksum covers sequence and value
+     */
+    struct Record {
+        std::uint64_t sequence;
+        std::uint32_t checksum;
+        std::uint32_t reserved;
+        T value;
+    }; // struct Record
+    static constexpr std::size_t RECORDS_OFFSET =
+        (sizeof(Header) + alignof(Record) - 1) / alignof(Record) * alignof(Record);
+
+    Header *m_header {nullptr};
+    Record *m_records {nullptr};
+    void *m_mapping {nullptr};
+    std::size_t m_mappingLength {0},
+                m_page {0},
+                m_interval {0},
+                m_sinceSync {0};
+    const SYNC_ENUM m_sync;
+    /***************************************************************************//**
+    * @brief : Checksum of a record
+    *
+    * @param in: record - record of the mapping
+    * @return  : std::uint32_t - CRC-32 of its sequence and value
+    ******************************************************************************/
+    static auto checksum( const Record &record ) -> std::uint32_t;
+    /***************************************************************************//**
+    * @brief : Verify a record holds the element of a sequence number
+    *
+    * @param in: sequence - sequence number expected in the record
+    * @return  : true if the record matches and passes its checksum
+    ******************************************************************************/
+    auto intact( const std::uint64_t sequence ) const -> bool;
+    /***************************************************************************//**
+    * @brief : Write back the pages covering a range of the mapping
+    *
+    * @param in: address - first byte of the range
+    * @param in: length  - number of bytes
+    * @param in: flags   - MS_SYNC or MS_ASYNC
+    ******************************************************************************/
+    auto writeBack( const void *address, const std::size_t length, const int flags ) -> void;
+    /***************************************************************************//**
+    * @brief : Roll the header forward over the records put after its last
+    *          update, then clamp the head to the window
+    *
+    * @param : none
+    ******************************************************************************/
+    auto recover() -> void;
+}; // class PersistentCircularBuffer
+/***********************************************************
+ *                Functions definition
+************************************************************/
+template < typename T, std::size_t size >
+PersistentCircularBuffer<T, size>::PersistentCircularBuffer( const std::string &path, SYNC_ENUM sync,
+                                                             std::size_t interval )
+    : m_page(static_cast<std::size_t>(::sysconf(_SC_PAGESIZE))),
+      m_interval((0 == interval) ? 1 : interval),
+      m_sync(sync) {
+    m_mappingLength = RECORDS_OFFSET + size * sizeof(Record);
+    const int fd = ::open(path.c_str(), O_RDWR | O_CREAT, S_IRUSR | S_IWUSR);
+    if (fd < 0)
+        throw Exception("Cannot open file");
+    struct stat status;
+    if (0 != ::fstat(fd, &status)) {
+        ::close(fd);
+        throw Exception("Cannot open file");
+    }
+    const bool created = (0 == status.st_size);
+    if (!created && static_cast<std::size_t>(status.st_size) != m_mappingLength) {
+        ::close(fd);
+        throw Exception("File is not a persistent circular buffer");
+    }
+    if (created && 0 != ::ftruncate(fd, static_cast<off_t>(m_mappingLength))) {
+        ::close(fd);
+        throw Exception("Cannot size file");
+    }
+    m_mapping = ::mmap(nullptr, m_mappingLength, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    // the mapping keeps the file open
+    ::close(fd);
+    if (MAP_FAILED == m_mapping)
+        throw Exception("Cannot map file");
+    m_header = static_cast<Header*>(m_mapping);
+    m_records = reinterpret_cast<Record*>(static_cast<unsigned char*>(m_mapping) + RECORDS_OFFSET);
+    if (created) {
+        // a new file reads as zeros, records of sequence 0 fail their checksum
+        new (m_header) Header();
+        m_header->recordSize = sizeof(Record);
+        m_header->capacity = size;
+        m_header->magic = MAGIC;
+        writeBack(m_header, sizeof(Header), MS_SYNC);
+    } else if (MAGIC != m_header->magic || sizeof(Record) != m_header->recordSize
+               || size != m_header->capacity) {
+        ::munmap(m_mapping, m_mappingLength);
+        throw Exception("File is not a persistent circular buffer");
+    } else {
+        recover();
+    }
+}
+
+template < typename T, std::size_t size >
+PersistentCircularBuffer<T, size>::~PersistentCircularBuffer() {
+    if (SYNC_NONE != m_sync)
+        ::msync(m_mapping, m_mappingLength, MS_SYNC);
+    ::munmap(m_mapping, m_mappingLength);
+}
+
+template < typename T, std::size_t size >
+auto PersistentCircularBuffer<T, size>::put( const T &input ) -> void {
+    const auto tail = m_header->tail.load(std::memory_order_relaxed);
+    // release the slot before overwriting it so a torn write is never
+    // part of the window
+    if (tail - m_header->head.load(std::memory_order_relaxed) == size)
+        m_header->head.store(tail - size + 1, std::memory_order_release);
+    auto &record = m_records[tail % size];
+    record.sequence = tail;
+    std::memcpy(&record.value, &input, sizeof(T));
+    record.checksum = checksum(record);
+    m_header->tail.store(tail + 1, std::memory_order_release);
+    if (SYNC_ALWAYS == m_sync) {
+        writeBack(&record, sizeof(Record), MS_SYNC);
+        writeBack(m_header, sizeof(Header), MS_SYNC);
+    } else if (SYNC_PERIODIC == m_sync && ++m_sinceSync >= m_interval) {
+        m_sinceSync = 0;
+        writeBack(m_mapping, m_mappingLength, MS_ASYNC);
+    }
+}
+
+template < typename T, std::size_t size >
+auto PersistentCircularBuffer<T, size>::get( T &output ) -> bool {
+    const auto tail = m_header->tail.load(std::memory_order_relaxed);
+    for ( auto head = m_header->head.load(std::memory_order_relaxed); head != tail; ) {
+        const bool found = intact(head);
+        if (found)
+            std::memcpy(&output, &m_records[head % size].value, sizeof(T));
+        m_header->head.store(++head, std::memory_order_release);
+        if (found) return true;
+    }
+    return false;
+}
+
+template < typename T, std::size_t size >
+auto PersistentCircularBuffer<T, size>::removeAll() -> void {
+    m_header->head.store(m_header->tail.load(std::memory_order_relaxed), std::memory_order_release);
+    if (SYNC_ALWAYS == m_sync)
+        writeBack(m_header, sizeof(Header), MS_SYNC);
+}
+
+template < typename T, std::size_t size >
+auto PersistentCircularBuffer<T, size>::flush() -> void {
+    m_sinceSync = 0;
+    writeBack(m_mapping, m_mappingLength, MS_SYNC);
+}
+
+template < typename T, std::size_t size >
+auto PersistentCircularBuffer<T, size>::valid( const std::size_t index ) const -> bool {
+    return intact(sequence(index));
+}
+
+template < typename T, std::size_t size >
+auto PersistentCircularBuffer<T, size>::operator[] ( const std::size_t index ) const -> T {
+    const auto position = sequence(index);
+    if (!intact(position))
+        throw Exception("Record is corrupted");
+    T output;
+    std::memcpy(&output, &m_records[position % size].value, sizeof(T));
+    return output;
+}
+
+template < typename T, std::size_t size >
+auto PersistentCircularBuffer<T, size>::sequence( const std::size_t index ) const -> std::uint64_t {
+    if (index >= count())
+        throw Exception("Index out of range");
+    return m_header->head.load(std::memory_order_relaxed) + index;
+}
+
+template < typename T, std::size_t size >
+auto PersistentCircularBuffer<T, size>::empty() const -> bool {
+    return (0 == count());
+}
+
+template < typename T, std::size_t size >
+auto PersistentCircularBuffer<T, size>::count() const -> std::size_t {
+    const auto head = m_header->head.load(std::memory_order_relaxed);
+    return static_cast<std::size_t>(m_header->tail.load(std::memory_order_relaxed) - head);
+}
+
+template < typename T, std::size_t size >
+auto PersistentCircularBuffer<T, size>::checksum( const Record &record ) -> std::uint32_t {
+    return crc32(&record.value, sizeof(T), crc32(&record.sequence, sizeof(record.sequence)));
+}
+
+template < typename T, std::size_t size >
+auto PersistentCircularBuffer<T, size>::intact( const std::uint64_t sequence ) const -> bool {
+    const auto &record = m_records[sequence % size];
+    return sequence == record.sequence && checksum(record) == record.checksum;
+}
+
+template < typename T, std::size_t size >
+auto PersistentCircularBuffer<T, size>::writeBack( const void *address, const std::size_t length, const int flags ) -> void {
+    // msync wants a page aligned address
+    const auto begin = reinterpret_cast<std::uintptr_t>(address) / m_page * m_page;
+    const auto end = reinterpret_cast<std::uintptr_t>(address) + length;
+    ::msync(reinterpret_cast<void*>(begin), end - begin, flags);
+}
+
+template < typename T, std::size_t size >
+auto PersistentCircularBuffer<T, size>::recover() -> void {
+    auto tail = m_header->tail.load(std::memory_order_relaxed);
+    // a crash may land between writing a record and publishing it
+    for ( std::size_t i(0); i < size && intact(tail); ++i )
+        tail++;
+    auto head = m_header->head.load(std::memory_order_relaxed);
+    if (head > tail) head = tail;
+    if (tail - head > size) head = tail - size;
+    m_header->head.store(head, std::memory_order_relaxed);
+    m_header->tail.store(tail, std::memory_order_relaxed);
+}
+
+#endif
@@ -0,0 +1,300 @@
+/** @file SharedCircularBuffer.hpp
+ *  @brief Class definition of a circular buffer shared between processes
+ *
+ *  The ring lives in a POSIX shared memory object that any process of
+ *  the host attaches by name. Its data region is mapped twice, back to
+ *  back, so the free and the used parts of the ring are always one
+ *  contiguous range of memory: writers and readers get a pointer and
+ *  a length and never handle the wrap point. The producer and consumer
+ *  counters live in the shared header. One producer and one consumer,
+ *  possibly in different processes, may use the ring at once.
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+#ifndef SHAREDCIRCULARBUFFER_HPP_
+#define SHAREDCIRCULARBUFFER_HPP_
+
+/***********************************************************
+ *                   std includes
+***********************************************************/
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string>
+
+/***********************************************************
+ *                   system includes
+***********************************************************/
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/***********************************************************
+ *                 internal includes
+***********************************************************/
+#include "../Misc/constants.hpp"
+#include "../Misc/Exception.hpp"
+
+/** @enum SHARED_ENUM
+*   @brief how a shared circular buffer is opened
+*/
+enum SHARED_ENUM
+{
+    SHARED_CREATE = 0,
+    SHARED_ATTACH
+}; // enum SHARED_ENUM
+
+/** @class SharedCircularBuffer
+ *  @brief This class define a byte ring in shared memory, mapped twice
+ *         so that every region handed out is contiguous.
+ */
+class SharedCircularBuffer final {
+public:
+    /** @struct Region
+     *  @brief Contiguous range of the ring
+     */
+    struct Region {
+        unsigned char *data;
+        std::size_t length;
+    }; // struct Region
+    /***************************************************************************//**
+    * @brief : Constructor, creates or attaches the shared memory object
+    *
+    * @param in: name     - name of the object, starts with '/'
+    * @param in: mode     - SHARED_CREATE replaces any object of that name,
+    *                       SHARED_ATTACH opens one created by another process
+    * @param in: capacity - bytes of the ring when created, rounded up to a
+    *                       multiple of the page size, ignored on attach
+    ******************************************************************************/
+    SharedCircularBuffer( const std::string &name, SHARED_ENUM mode, std::size_t capacity = 0 );
+    /***************************************************************************//**
+    * @brief : Destructor, unmaps the ring, the shared object is kept
+    *
+    * @param : none
+    ******************************************************************************/
+    ~SharedCircularBuffer();
+    SharedCircularBuffer( const SharedCircularBuffer & ) = delete;
+    auto operator=( const SharedCircularBuffer & ) -> SharedCircularBuffer& = delete;
+    /***************************************************************************//**
+    * @brief : Remove a shared memory object, processes that attached it
+    *          keep their mapping
+    *
+    * @param in: name - name of the object
+    ******************************************************************************/
+    static auto remove( const std::string &name ) -> void;
+    /***************************************************************************//**
+    * @brief : Free part of the ring, producer only. Fill up to length bytes
+    *          then publish them with commitWrite.
+    *
+    * @param  : none
+    * @return : Region - contiguous free bytes, length is 0 if the ring is full
+    ******************************************************************************/
+    auto writeRegion() -> Region;
+    /***************************************************************************//**
+    * @brief : Publish bytes written in the region of writeRegion
+    *
+    * @param in: count - number of bytes, at most the length of the region
+    ******************************************************************************/
+    auto commitWrite( const std::size_t count ) -> void;
+    /***************************************************************************//**
+    * @brief : Used part of the ring, consumer only. Read up to length bytes
+    *          then release them with commitRead.
+    *
+    * @param  : none
+    * @return : Region - contiguous bytes to read, length is 0 if the ring is
+    *           empty
+    ******************************************************************************/
+    auto readRegion() -> Region;
+    /***************************************************************************//**
+    * @brief : Release bytes read in the region of readRegion
+    *
+    * @param in: count - number of bytes, at most the length of the region
+    ******************************************************************************/
+    auto commitRead( const std::size_t count ) -> void;
+    /***************************************************************************//**
+    * @brief : Copy bytes into the ring, producer only
+    *
+    * @param in: input - bytes to copy
+    * @param in: count - number of bytes
+    * @return  : std::size_t - number of bytes copied, less if the ring fills up
+    ******************************************************************************/
+    auto write( const void *input, const std::size_t count ) -> std::size_t;
+    /***************************************************************************//**
+    * @brief : Copy bytes out of the ring, consumer only
+    *
+    * @param out: output - receives the bytes
+    * @param in : count  - maximum number of bytes
+    * @return   : std::size_t - number of bytes copied
+    ******************************************************************************/
+    auto read( void *output, const std::size_t count ) -> std::size_t;
+    /***************************************************************************//**
+    * @brief : Bytes of the ring
+    *
+    * @param  : none
+    * @return : std::size_t - capacity of the ring
+    ******************************************************************************/
+    auto capacity() const -> std::size_t;
+    /***************************************************************************//**
+    * @brief : Bytes waiting to be read, a snapshot while the other side runs
+    *
+    * @param  : none
+    * @return : std::size_t - number of bytes
+    ******************************************************************************/
+    auto count() const -> std::size_t;
+private:
+    static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "Shared counters must be lock-free");
+    static constexpr std::uint64_t MAGIC = 0x53484D52494E4731ULL;
+    /** @struct Header
+     *  @brief First page of the shared object, the data pages follow it
+     */
+    struct Header {
+        std::atomic<std::uint64_t> magic;
+        std::uint64_t capacity;
+        alignas(CACHE_LINE_SIZE) std::atomic<std::uint64_t> writeIndex;
+        alignas(CACHE_LINE_SIZE) std::atomic<std::uint64_t> readIndex;
+    }; // struct Header
+
+    Header *m_header {nullptr};
+    unsigned char *m_data {nullptr};
+    void *m_mapping {nullptr};
+    std::size_t m_mappingLength {0},
+                m_headerLength {0},
+                m_capacity {0};
+    /***************************************************************************//**
+    * @brief : Map the header once and the data twice
+    *
+    * @param in: fd - descriptor of the shared object
+    ******************************************************************************/
+    auto map( const int fd ) -> void;
+}; // class SharedCircularBuffer
+/***********************************************************
+ *                Functions definition
+************************************************************/
+inline SharedCircularBuffer::SharedCircularBuffer( const std::string &name, SHARED_ENUM mode, std::size_t capacity ) {
+    const auto page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    m_headerLength = (sizeof(Header) + page - 1) / page * page;
+    int fd = -1;
+    if (SHARED_CREATE == mode) {
+        if (0 == capacity)
+            throw Exception("Capacity must not be null");
+        m_capacity = (capacity + page - 1) / page * page;
+        ::shm_unlink(name.c_str());
+        fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+        if (fd < 0)
+            throw Exception("Cannot create shared memory");
+        if (0 != ::ftruncate(fd, static_cast<off_t>(m_headerLength + m_capacity))) {
+            ::close(fd);
+            ::shm_unlink(name.c_str());
+            throw Exception("Cannot size shared memory");
+        }
+    } else {
+        fd = ::shm_open(name.c_str(), O_RDWR, 0);
+        if (fd < 0)
+            throw Exception("Cannot attach shared memory");
+        struct stat status;
+        if (0 != ::fstat(fd, &status) || static_cast<std::size_t>(status.st_size) <= m_headerLength) {
+            ::close(fd);
+            throw Exception("Shared memory is not a circular buffer");
+        }
+        m_capacity = static_cast<std::size_t>(status.st_size) - m_headerLength;
+    }
+    try {
+        map(fd);
+    } catch (...) {
+        ::close(fd);
+        throw;
+    }
+    // the mappings keep the object alive
+    ::close(fd);
+    if (SHARED_CREATE == mode) {
+        new (m_header) Header();
+        m_header->capacity = m_capacity;
+        // attaching processes check the magic last written
+        m_header->magic.store(MAGIC, std::memory_order_release);
+    } else if (MAGIC != m_header->magic.load(std::memory_order_acquire)
+               || m_header->capacity != m_capacity) {
+        ::munmap(m_mapping, m_mappingLength);
+        throw Exception("Shared memory is not a circular buffer");
+    }
+}
+
+inline SharedCircularBuffer::~SharedCircularBuffer() {
+    ::munmap(m_mapping, m_mappingLength);
+}
+
+inline auto SharedCircularBuffer::remove( const std::string &name ) -> void {
+    ::shm_unlink(name.c_str());
+}
+
+inline auto SharedCircularBuffer::map( const int fd ) -> void {
+    // reserve the whole range first so that both data mappings are adjacent
+    m_mappingLength = m_headerLength + 2 * m_capacity;
+    auto base = ::mmap(nullptr, m_mappingLength, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (MAP_FAILED == base)
+        throw Exception("Cannot reserve address space");
+    auto bytes = static_cast<unsigned char*>(base);
+    auto first = ::mmap(bytes, m_headerLength + m_capacity, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_FIXED, fd, 0);
+    auto second = ::mmap(bytes + m_headerLength + m_capacity, m_capacity, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_FIXED, fd, static_cast<off_t>(m_headerLength));
+    if (MAP_FAILED == first || MAP_FAILED == second) {
+        ::munmap(base, m_mappingLength);
+        throw Exception("Cannot map shared memory");
+    }
+    m_mapping = base;
+    m_header = reinterpret_cast<Header*>(bytes);
+    m_data = bytes + m_headerLength;
+}
+
+inline auto SharedCircularBuffer::writeRegion() -> Region {
+    const auto write = m_header->writeIndex.load(std::memory_order_relaxed);
+    const auto read = m_header->readIndex.load(std::memory_order_acquire);
+    return Region { m_data + write % m_capacity, m_capacity - static_cast<std::size_t>(write - read) };
+}
+
+inline auto SharedCircularBuffer::commitWrite( const std::size_t count ) -> void {
+    const auto write = m_header->writeIndex.load(std::memory_order_relaxed);
+    m_header->writeIndex.store(write + count, std::memory_order_release);
+}
+
+inline auto SharedCircularBuffer::readRegion() -> Region {
+    const auto read = m_header->readIndex.load(std::memory_order_relaxed);
+    const auto write = m_header->writeIndex.load(std::memory_order_acquire);
+    return Region { m_data + read % m_capacity, static_cast<std::size_t>(write - read) };
+}
+
+inline auto SharedCircularBuffer::commitRead( const std::size_t count ) -> void {
+    const auto read = m_header->readIndex.load(std::memory_order_relaxed);
+    m_header->readIndex.store(read + count, std::memory_order_release);
+}
+
+inline auto SharedCircularBuffer::write( const void *input, const std::size_t count ) -> std::size_t {
+    auto region = writeRegion();
+    const auto copied = (count < region.length) ? count : region.length;
+    std::memcpy(region.data, input, copied);
+    commitWrite(copied);
+    return copied;
+}
+
+inline auto SharedCircularBuffer::read( void *output, const std::size_t count ) -> std::size_t {
+    auto region = readRegion();
+    const auto copied = (count < region.length) ? count : region.length;
+    std::memcpy(output, region.data, copied);
+    commitRead(copied);
+    return copied;
+}
+
+inline auto SharedCircularBuffer::capacity() const -> std::size_t {
+    return m_capacity;
+}
+
+inline auto SharedCircularBuffer::count() const -> std::size_t {
+    const auto read = m_header->readIndex.load(std::memory_order_acquire);
+    return static_cast<std::size_t>(m_header->writeIndex.load(std::memory_order_acquire) - read);
+}
+
+#endif
@@ -0,0 +1,295 @@
+/** @file SlidingWindow.hpp
+ *  @brief Class definition of aggregates over a sliding window
+ *
+ *  SlidingWindow keeps the last size values in an array backed
+ *  CircularBuffer and updates its aggregates on every put instead of
+ *  walking the window. Sum, mean and variance follow the value that
+ *  enters and the one that leaves in O(1), using Welford's update for
+ *  the variance. Min and max come from monotonic queues in amortized
+ *  O(1). Rounding errors of the running sums are cancelled by a full
+ *  recompute every size puts, amortized O(1) as well.
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+#ifndef SLIDINGWINDOW_HPP_
+#define SLIDINGWINDOW_HPP_
+
+/***********************************************************
+ *                   std includes
+***********************************************************/
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+/***********************************************************
+ *                 internal includes
+***********************************************************/
+#include "CircularBuffer.hpp"
+#include "../Misc/Exception.hpp"
+
+template < typename T, std::size_t size >
+/** @class SlidingWindow
+ *  @brief This class define running aggregates of the last size values
+ *         put. Not synchronized.
+ */
+class SlidingWindow final {
+    static_assert(std::is_arithmetic<T>::value, "A sliding window aggregates arithmetic values");
+public:
+    /***************************************************************************//**
+    * @brief : Constructor
+    *
+    * @param : none
+    ******************************************************************************/
+    SlidingWindow() = default;
+    /***************************************************************************//**
+    * @brief : Destructor
+    *
+    * @param : none
+    ******************************************************************************/
+    ~SlidingWindow() = default;
+    /***************************************************************************//**
+    * @brief : add a value, the oldest one leaves a full window
+    *
+    * @param in : input - value
+    ******************************************************************************/
+    auto put( const T input ) -> void;
+    /***************************************************************************//**
+    * @brief : Remove every value
+    *
+    * @param : none
+    ******************************************************************************/
+    auto clear() -> void;
+    /***************************************************************************//**
+    * @brief : Recompute sum, mean and variance from the values of the window
+    *
+    * @param : none
+    ******************************************************************************/
+    auto resync() -> void;
+    /***************************************************************************//**
+    * @brief : Number of values in the window
+    *
+    * @param  : none
+    * @return : std::size_t - number of values, at most size
+    ******************************************************************************/
+    auto count() const -> std::size_t;
+    /***************************************************************************//**
+    * @brief : Verify if the window is empty
+    *
+    * @param  : none
+    * @return : Return true if count() is 0
+    ******************************************************************************/
+    auto empty() const -> bool;
+    /***************************************************************************//**
+    * @brief : Sum of the values, 0 when empty
+    *
+    * @param  : none
+    * @return : double - sum
+    ******************************************************************************/
+    auto sum() const -> double;
+    /***************************************************************************//**
+    * @brief : Mean of the values, 0 when empty
+    *
+    * @param  : none
+    * @return : double - mean
+    ******************************************************************************/
+    auto mean() const -> double;
+    /***************************************************************************//**
+    * @brief : Population variance of the values, 0 when empty
+    *
+    * @param  : none
+    * @return : double - variance
+    ******************************************************************************/
+    auto variance() const -> double;
+    /***************************************************************************//**
+    * @brief : Smallest value, throws when empty
+    *
+    * @param  : none
+    * @return : T - minimum
+    ******************************************************************************/
+    auto min() const -> T;
+    /***************************************************************************//**
+    * @brief : Largest value, throws when empty
+    *
+    * @param  : none
+    * @return : T - maximum
+    ******************************************************************************/
+    auto max() const -> T;
+    /***************************************************************************//**
+    * @brief : Index operator, 0 is the oldest value
+    *
+    * @param in:  index position
+    * @return  :  value at position index
+    ******************************************************************************/
+    auto operator[] ( const std::size_t index ) -> T;
+private:
+    template < typename Compare >
+    /** @class MonotonicQueue
+     *  @brief Values of the window that no later value beats, front is
+     *         the extremum. Each value is pushed and popped once.
+     */
+    class MonotonicQueue final {
+    public:
+        auto push( const std::uint64_t sequence, const T value ) -> void {
+            // values put size puts ago left the window
+            while (0 != m_count && m_items[m_head].sequence + size <= sequence)
+                popFront();
+            while (0 != m_count && !Compare()(m_items[slot(m_count - 1)].value, value))
+                m_count--;
+            m_items[slot(m_count)] = Entry { sequence, value };
+            m_count++;
+        }
+        auto front() const -> T {
+            return m_items[m_head].value;
+        }
+        auto clear() -> void {
+            m_head = 0;
+            m_count = 0;
+        }
+    private:
+        /** @struct Entry
+         *  @brief Value and its put sequence
+         */
+        struct Entry {
+            std::uint64_t sequence;
+            T value;
+        }; // struct Entry
+        std::array<Entry, size> m_items {};
+        std::size_t m_head {0},
+                    m_count {0};
+
+        auto slot( const std::size_t offset ) const -> std::size_t {
+            return (m_head + offset) % size;
+        }
+        auto popFront() -> void {
+            m_head = slot(1);
+            m_count--;
+        }
+    }; // class MonotonicQueue
+
+    CircularBuffer<T, size, STORAGE_ARRAY> m_buffer;
+    MonotonicQueue<std::less<T>> m_min;
+    MonotonicQueue<std::greater<T>> m_max;
+    std::array<T, size> m_scratch {};
+    std::uint64_t m_puts {0};
+    std::size_t m_count {0},
+                m_sinceResync {0};
+    double m_sum {0.0},
+           m_mean {0.0},
+           m_squares {0.0};
+}; // class SlidingWindow
+/***********************************************************
+ *                Functions definition
+************************************************************/
+template < typename T, std::size_t size >
+auto SlidingWindow<T, size>::put( const T input ) -> void {
+    const auto value = static_cast<double>(input);
+    if (size == m_count) {
+        const auto oldest = static_cast<double>(m_buffer[0]);
+        const auto mean = m_mean + (value - oldest) / m_count;
+        m_squares += (value - oldest) * (value - mean + oldest - m_mean);
+        m_mean = mean;
+        m_sum += value - oldest;
+    } else {
+        m_count++;
+        const auto delta = value - m_mean;
+        m_mean += delta / m_count;
+        m_squares += delta * (value - m_mean);
+        m_sum += value;
+    }
+    m_buffer.put(input);
+    m_min.push(m_puts, input);
+    m_max.push(m_puts, input);
+    m_puts++;
+    if (++m_sinceResync >= size)
+        resync();
+}
+
+template < typename T, std::size_t size >
+auto SlidingWindow<T, size>::clear() -> void {
+    m_buffer.removeAll();
+    m_min.clear();
+    m_max.clear();
+    m_count = 0;
+    m_sinceResync = 0;
+    m_sum = m_mean = m_squares = 0.0;
+}
+
+template < typename T, std::size_t size >
+auto SlidingWindow<T, size>::resync() -> void {
+    m_sinceResync = 0;
+    const auto count = m_buffer.peek(m_scratch.data(), size);
+    if (0 == count) return;
+    // independent accumulators let the compiler vectorize both passes
+    // without reordering a single floating point chain
+    double partial[4] = {0.0, 0.0, 0.0, 0.0};
+    std::size_t i(0);
+    for ( ; i + 4 <= count; i += 4 )
+        for ( std::size_t lane(0); lane < 4; ++lane )
+            partial[lane] += static_cast<double>(m_scratch[i + lane]);
+    for ( ; i < count; ++i )
+        partial[0] += static_cast<double>(m_scratch[i]);
+    m_sum = (partial[0] + partial[1]) + (partial[2] + partial[3]);
+    m_mean = m_sum / count;
+    double squares[4] = {0.0, 0.0, 0.0, 0.0};
+    for ( i = 0; i + 4 <= count; i += 4 ) {
+        for ( std::size_t lane(0); lane < 4; ++lane ) {
+            const auto delta = static_cast<double>(m_scratch[i + lane]) - m_mean;
+            squares[lane] += delta * delta;
+        }
+    }
+    for ( ; i < count; ++i ) {
+        const auto delta = static_cast<double>(m_scratch[i]) - m_mean;
+        squares[0] += delta * delta;
+    }
+    m_squares = (squares[0] + squares[1]) + (squares[2] + squares[3]);
+}
+
+template < typename T, std::size_t size >
+auto SlidingWindow<T, size>::count() const -> std::size_t {
+    return m_count;
+}
+
+template < typename T, std::size_t size >
+auto SlidingWindow<T, size>::empty() const -> bool {
+    return (0 == m_count);
+}
+
+template < typename T, std::size_t size >
+auto SlidingWindow<T, size>::sum() const -> double {
+    return m_sum;
+}
+
+template < typename T, std::size_t size >
+auto SlidingWindow<T, size>::mean() const -> double {
+    return m_mean;
+}
+
+template < typename T, std::size_t size >
+auto SlidingWindow<T, size>::variance() const -> double {
+    // rounding may leave a tiny negative value for a constant window
+    return (0 == m_count || m_squares <= 0.0) ? 0.0 : m_squares / m_count;
+}
+
+template < typename T, std::size_t size >
+auto SlidingWindow<T, size>::min() const -> T {
+    if (0 == m_count)
+        throw Exception("Window is empty");
+    return m_min.front();
+}
+
+template < typename T, std::size_t size >
+auto SlidingWindow<T, size>::max() const -> T {
+    if (0 == m_count)
+        throw Exception("Window is empty");
+    return m_max.front();
+}
+
+template < typename T, std::size_t size >
+auto SlidingWindow<T, size>::operator[] ( const std::size_t index ) -> T {
+    return m_buffer[index];
+}
+
+#endif
@@ -0,0 +1,179 @@
+/** @file SpscCircularBuffer.hpp
+ *  @brief Class definition of a lock-free single producer single
+ *         consumer circular buffer
+ *
+ *  One thread puts, one thread gets. The producer owns the tail
+ *  counter and the consumer the head counter, each on its own cache
+ *  line next to a cached copy of the other side's counter, so the
+ *  shared line is only read when the cached copy says the buffer
+ *  looks full (or empty). Counters grow forever, publishing an
+ *  element is a release store and observing one an acquire load.
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+#ifndef SPSCCIRCULARBUFFER_HPP_
+#define SPSCCIRCULARBUFFER_HPP_
+
+/***********************************************************
+ *                   std includes
+***********************************************************/
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/***********************************************************
+ *                 internal includes
+***********************************************************/
+#include "../Misc/constants.hpp"
+
+template < typename T, std::size_t size >
+/** @class SpscCircularBuffer
+ *  @brief This class define a bounded buffer shared by exactly one
+ *         producer thread and one consumer thread. It never overwrites,
+ *         try_put fails while the buffer is full.
+ */
+class SpscCircularBuffer final {
+    static_assert(size > 0, "A circular buffer holds at least one element");
+public:
+    /***************************************************************************//**
+    * @brief : Constructor
+    *
+    * @param : none
+    ******************************************************************************/
+    SpscCircularBuffer() = default;
+    /***************************************************************************//**
+    * @brief : Destructor, destroys the elements left in the buffer
+    *
+    * @param : none
+    ******************************************************************************/
+    ~SpscCircularBuffer();
+    SpscCircularBuffer( const SpscCircularBuffer & ) = delete;
+    auto operator=( const SpscCircularBuffer & ) -> SpscCircularBuffer& = delete;
+    /***************************************************************************//**
+    * @brief : add an element to buffer, producer thread only
+    *
+    * @param in : input - const T
+    * @return   : false if the buffer is full
+    ******************************************************************************/
+    auto try_put( const T &input ) -> bool;
+    /***************************************************************************//**
+    * @brief : add an element to buffer, input is moved, producer thread only
+    *
+    * @param in : input - T rvalue, left untouched if the buffer is full
+    * @return   : false if the buffer is full
+    ******************************************************************************/
+    auto try_put( T &&input ) -> bool;
+    /***************************************************************************//**
+    * @brief : construct an element in place, producer thread only
+    *
+    * @param in : args - arguments forwarded to the constructor of T
+    * @return   : false if the buffer is full
+    ******************************************************************************/
+    template < typename... Args >
+    auto try_emplace( Args&&... args ) -> bool;
+    /***************************************************************************//**
+    * @brief : remove the oldest element, consumer thread only
+    *
+    * @param out : output - receives the element
+    * @return    : false if the buffer is empty
+    ******************************************************************************/
+    auto try_get( T &output ) -> bool;
+    /***************************************************************************//**
+    * @brief : Number of elements, exact from the producer or the consumer
+    *          thread when the other side is idle, a snapshot otherwise
+    *
+    * @param  : none
+    * @return : std::size_t - number of elements
+    ******************************************************************************/
+    auto count() const -> std::size_t;
+    /***************************************************************************//**
+    * @brief : Verify if the buffer is empty
+    *
+    * @param  : none
+    * @return : Return true if count() is 0
+    ******************************************************************************/
+    auto empty() const -> bool;
+private:
+    using Storage = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+    static constexpr bool POWER_OF_TWO = (0 == (size & (size - 1)));
+
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> m_tail {0};
+    std::size_t m_cachedHead {0};
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> m_head {0};
+    std::size_t m_cachedTail {0};
+    alignas(CACHE_LINE_SIZE) Storage m_items[size];
+    /***************************************************************************//**
+    * @brief : Element stored for a counter value
+    *
+    * @param in : position - head or tail counter
+    * @return   : pointer to the slot
+    ******************************************************************************/
+    auto slot( const std::size_t position ) -> T*;
+}; // class SpscCircularBuffer
+/***********************************************************
+ *                Functions definition
+************************************************************/
+template < typename T, std::size_t size >
+SpscCircularBuffer<T, size>::~SpscCircularBuffer() {
+    const auto tail = m_tail.load(std::memory_order_relaxed);
+    for ( auto head = m_head.load(std::memory_order_relaxed); head != tail; ++head )
+        slot(head)->~T();
+}
+
+template < typename T, std::size_t size >
+auto SpscCircularBuffer<T, size>::try_put( const T &input ) -> bool {
+    return try_emplace(input);
+}
+
+template < typename T, std::size_t size >
+auto SpscCircularBuffer<T, size>::try_put( T &&input ) -> bool {
+    return try_emplace(std::move(input));
+}
+
+template < typename T, std::size_t size >
+template < typename... Args >
+auto SpscCircularBuffer<T, size>::try_emplace( Args&&... args ) -> bool {
+    const auto tail = m_tail.load(std::memory_order_relaxed);
+    if (tail - m_cachedHead == size) {
+        m_cachedHead = m_head.load(std::memory_order_acquire);
+        if (tail - m_cachedHead == size) return false;
+    }
+    new (slot(tail)) T(std::forward<Args>(args)...);
+    m_tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+template < typename T, std::size_t size >
+auto SpscCircularBuffer<T, size>::try_get( T &output ) -> bool {
+    const auto head = m_head.load(std::memory_order_relaxed);
+    if (head == m_cachedTail) {
+        m_cachedTail = m_tail.load(std::memory_order_acquire);
+        if (head == m_cachedTail) return false;
+    }
+    auto item = slot(head);
+    output = std::move(*item);
+    item->~T();
+    m_head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+template < typename T, std::size_t size >
+auto SpscCircularBuffer<T, size>::count() const -> std::size_t {
+    const auto head = m_head.load(std::memory_order_acquire);
+    return m_tail.load(std::memory_order_acquire) - head;
+}
+
+template < typename T, std::size_t size >
+auto SpscCircularBuffer<T, size>::empty() const -> bool {
+    return (0 == count());
+}
+
+template < typename T, std::size_t size >
+auto SpscCircularBuffer<T, size>::slot( const std::size_t position ) -> T* {
+    return reinterpret_cast<T*>(&m_items[POWER_OF_TWO ? (position & (size - 1)) : (position % size)]);
+}
+
+#endif
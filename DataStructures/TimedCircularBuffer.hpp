@@ -0,0 +1,231 @@
+/** @file TimedCircularBuffer.hpp
+ *  @brief Class definition of a circular buffer of timestamped elements
+ *
+ *  TimedCircularBuffer keeps the elements put during the last horizon
+ *  of time, and at most size of them, in an array backed
+ *  CircularBuffer. Timestamps never go back, so the elements are
+ *  sorted by time: expired ones are always at the front and leave
+ *  through popFront on the next put, each once, in amortized O(1).
+ *  Looking up a time is a binary search over operator[].
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+#ifndef TIMEDCIRCULARBUFFER_HPP_
+#define TIMEDCIRCULARBUFFER_HPP_
+
+/***********************************************************
+ *                   std includes
+***********************************************************/
+#include <chrono>
+#include <cstddef>
+#include <utility>
+
+/***********************************************************
+ *                 internal includes
+***********************************************************/
+#include "CircularBuffer.hpp"
+#include "../Misc/Exception.hpp"
+
+template < typename T, std::size_t size, typename Clock = std::chrono::steady_clock >
+/** @class TimedCircularBuffer
+ *  @brief This class define a circular buffer that drops elements older
+ *         than a horizon. Once full, each put overwrites the oldest
+ *         element. Not synchronized.
+ */
+class TimedCircularBuffer final {
+public:
+    using TimePoint = typename Clock::time_point;
+    using Duration = typename Clock::duration;
+    /***************************************************************************//**
+    * @brief : Constructor
+    *
+    * @param in : horizon - age after which an element is dropped
+    ******************************************************************************/
+    explicit TimedCircularBuffer( const Duration horizon );
+    /***************************************************************************//**
+    * @brief : Destructor
+    *
+    * @param : none
+    ******************************************************************************/
+    ~TimedCircularBuffer() = default;
+    /***************************************************************************//**
+    * @brief : add an element stamped with the current time
+    *
+    * @param in : input - const T
+    ******************************************************************************/
+    auto put( const T &input ) -> void;
+    /***************************************************************************//**
+    * @brief : add an element, the elements older than time - horizon are
+    *          dropped
+    *
+    * @param in : input - const T
+    * @param in : time  - timestamp, not older than the newest element
+    ******************************************************************************/
+    auto put( const T &input, const TimePoint &time ) -> void;
+    /***************************************************************************//**
+    * @brief : Drop the elements older than now - horizon
+    *
+    * @param in : now - current time
+    * @return   : std::size_t - number of elements dropped
+    ******************************************************************************/
+    auto expire( const TimePoint &now = Clock::now() ) -> std::size_t;
+    /***************************************************************************//**
+    * @brief : Position of the first element stamped at or after a time
+    *
+    * @param in : time - time to look up
+    * @return   : std::size_t - index, count() if every element is older
+    ******************************************************************************/
+    auto lowerBound( const TimePoint &time ) -> std::size_t;
+    /***************************************************************************//**
+    * @brief : copy the elements stamped in [from, to), oldest first
+    *
+    * @param in  : from   - first time of the range
+    * @param in  : to     - end of the range, excluded
+    * @param out : output - receives up to count contiguous elements
+    * @param in  : count  - maximum number of elements
+    * @return    : std::size_t - number of elements copied
+    ******************************************************************************/
+    auto range( const TimePoint &from, const TimePoint &to, T *output, const std::size_t count ) -> std::size_t;
+    /***************************************************************************//**
+    * @brief : Timestamp of an element
+    *
+    * @param in:  index position
+    * @return  :  TimePoint - time given to put
+    ******************************************************************************/
+    auto timestamp( const std::size_t index ) -> TimePoint;
+    /***************************************************************************//**
+    * @brief : Remove all elements in current buffer
+    *
+    * @param : none
+    ******************************************************************************/
+    auto removeAll() -> void;
+    /***************************************************************************//**
+    * @brief : Verify if circular buffer is empty or not
+    *
+    * @param  : none
+    * @return : Return true if circular buffer is empty
+    ******************************************************************************/
+    auto empty() -> bool;
+    /***************************************************************************//**
+    * @brief : Number of elements, expired ones are counted until the next
+    *          put or expire
+    *
+    * @param  : none
+    * @return : std::size_t - number of elements, at most size
+    ******************************************************************************/
+    auto count() -> std::size_t;
+    /***************************************************************************//**
+    * @brief : Age after which an element is dropped
+    *
+    * @param  : none
+    * @return : Duration - horizon given to the constructor
+    ******************************************************************************/
+    auto horizon() const -> Duration;
+    /***************************************************************************//**
+    * @brief : Index operator
+    *
+    * @param in:  index position, 0 is the oldest element
+    * @return  :  Reference to data at position index
+    ******************************************************************************/
+    auto operator[] ( const std::size_t index ) -> T&;
+private:
+    /** @struct Entry
+     *  @brief Element and its timestamp
+     */
+    struct Entry {
+        TimePoint time;
+        T value;
+    }; // struct Entry
+
+    CircularBuffer<Entry, size, STORAGE_ARRAY> m_buffer;
+    const Duration m_horizon;
+}; // class TimedCircularBuffer
+/***********************************************************
+ *                Functions definition
+************************************************************/
+template < typename T, std::size_t size, typename Clock >
+TimedCircularBuffer<T, size, Clock>::TimedCircularBuffer( const Duration horizon )
+    : m_horizon(horizon) {
+}
+
+template < typename T, std::size_t size, typename Clock >
+auto TimedCircularBuffer<T, size, Clock>::put( const T &input ) -> void {
+    put(input, Clock::now());
+}
+
+template < typename T, std::size_t size, typename Clock >
+auto TimedCircularBuffer<T, size, Clock>::put( const T &input, const TimePoint &time ) -> void {
+    const auto stored = m_buffer.count();
+    if (0 != stored && time < m_buffer[stored - 1].time)
+        throw Exception("Timestamp is older than the newest element");
+    expire(time);
+    m_buffer.emplace(Entry { time, input });
+}
+
+template < typename T, std::size_t size, typename Clock >
+auto TimedCircularBuffer<T, size, Clock>::expire( const TimePoint &now ) -> std::size_t {
+    const auto limit = now - m_horizon;
+    std::size_t dropped(0);
+    while (!m_buffer.empty() && m_buffer[0].time < limit) {
+        m_buffer.popFront();
+        dropped++;
+    }
+    return dropped;
+}
+
+template < typename T, std::size_t size, typename Clock >
+auto TimedCircularBuffer<T, size, Clock>::lowerBound( const TimePoint &time ) -> std::size_t {
+    std::size_t first(0), last(m_buffer.count());
+    while (first < last) {
+        const auto middle = first + (last - first) / 2;
+        if (m_buffer[middle].time < time) first = middle + 1;
+        else last = middle;
+    }
+    return first;
+}
+
+template < typename T, std::size_t size, typename Clock >
+auto TimedCircularBuffer<T, size, Clock>::range( const TimePoint &from, const TimePoint &to,
+                                                 T *output, const std::size_t count ) -> std::size_t {
+    const auto stored = m_buffer.count();
+    std::size_t copied(0);
+    for ( auto i = lowerBound(from); i < stored && copied < count; ++i ) {
+        const auto &entry = m_buffer[i];
+        if (!(entry.time < to)) break;
+        output[copied++] = entry.value;
+    }
+    return copied;
+}
+
+template < typename T, std::size_t size, typename Clock >
+auto TimedCircularBuffer<T, size, Clock>::timestamp( const std::size_t index ) -> TimePoint {
+    return m_buffer[index].time;
+}
+
+template < typename T, std::size_t size, typename Clock >
+auto TimedCircularBuffer<T, size, Clock>::removeAll() -> void {
+    m_buffer.removeAll();
+}
+
+template < typename T, std::size_t size, typename Clock >
+auto TimedCircularBuffer<T, size, Clock>::empty() -> bool {
+    return m_buffer.empty();
+}
+
+template < typename T, std::size_t size, typename Clock >
+auto TimedCircularBuffer<T, size, Clock>::count() -> std::size_t {
+    return m_buffer.count();
+}
+
+template < typename T, std::size_t size, typename Clock >
+auto TimedCircularBuffer<T, size, Clock>::horizon() const -> Duration {
+    return m_horizon;
+}
+
+template < typename T, std::size_t size, typename Clock >
+auto TimedCircularBuffer<T, size, Clock>::operator[] ( const std::size_t index ) -> T& {
+    return m_buffer[index].value;
+}
+
+#endif
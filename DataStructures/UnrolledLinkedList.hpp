@@ -0,0 +1,563 @@
+/** @file UnrolledLinkedList.hpp
+ *  @brief Class definition of an unrolled doubly linked list
+ *
+ *  UnrolledLinkedList stores several elements per cache line
+ *  sized node. It offers the same add/popFront/popBack/remove
+ *  interface as LinkedList while chasing one pointer per node
+ *  instead of one pointer per element.
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+#ifndef UNROLLEDLINKEDLIST_HPP_
+#define UNROLLEDLINKEDLIST_HPP_
+
+/******************************
+ *     std includes
+*******************************/
+#include <iostream>
+#include <algorithm>
+#include <mutex>
+#include <new>
+#include <utility>
+
+/******************************
+ *    internal includes
+*******************************/
+#include "../Misc/node.hpp"
+#include "../Misc/constants.hpp"
+#include "../Misc/Exception.hpp"
+#include "LinkedList.hpp"
+
+template < typename T >
+/** @class UnrolledLinkedList
+ *  @brief This class define an unrolled doubly linked list
+ *         of any data type.
+ */
+class UnrolledLinkedList final {
+public:
+    /***************************************************************************//**
+    * @brief : Constructor
+    *
+    * @param : none
+    ******************************************************************************/
+    UnrolledLinkedList() = default;
+    /***************************************************************************//**
+    * @brief : Destructor
+    *
+    * @param : none
+    ******************************************************************************/
+    ~UnrolledLinkedList();
+    /***************************************************************************//**
+    * @brief : Append a new element to the current list
+    *
+    * @param in: data  - const T type
+    ******************************************************************************/
+    auto add( const T &data ) -> void;
+    /***************************************************************************//**
+    * @brief : Append a new element to the current list, data is moved
+    *
+    * @param in: data  - T rvalue
+    ******************************************************************************/
+    auto add( T &&data ) -> void;
+    /***************************************************************************//**
+    * @brief : Add new element to the head of the current list
+    *
+    * @param in: data  - const T type
+    ******************************************************************************/
+    auto addFront( const T &data ) -> void;
+    /***************************************************************************//**
+    * @brief : Add new element to the head of the current list, data is moved
+    *
+    * @param in: data  - T rvalue
+    ******************************************************************************/
+    auto addFront( T &&data ) -> void;
+    /***************************************************************************//**
+    * @brief : Insert a new element before position index
+    *
+    * @param in: data  - const T type
+    * @param in: index - position of the new element, size() appends
+    ******************************************************************************/
+    auto insert( const T &data, const std::size_t index ) -> void;
+    /***************************************************************************//**
+    * @brief : Construct a new element at the end of the list
+    *
+    * @param in: args  - arguments forwarded to the constructor of T
+    * @return  : Reference to the new element
+    ******************************************************************************/
+    template < typename... Args >
+    auto emplace_back( Args&&... args ) -> T&;
+    /***************************************************************************//**
+    * @brief : Construct a new element at the head of the list
+    *
+    * @param in: args  - arguments forwarded to the constructor of T
+    * @return  : Reference to the new element
+    ******************************************************************************/
+    template < typename... Args >
+    auto emplace_front( Args&&... args ) -> T&;
+    /***************************************************************************//**
+    * @brief : Construct a new element before position index. Elements after
+    *          it in the same node are shifted, so only an element appended
+    *          at the end of a node is built directly in its slot.
+    *
+    * @param in: index - position of the new element, size() appends
+    * @param in: args  - arguments forwarded to the constructor of T
+    * @return  : Reference to the new element
+    ******************************************************************************/
+    template < typename... Args >
+    auto emplace( const std::size_t index, Args&&... args ) -> T&;
+    /***************************************************************************//**
+    * @brief : Remove first or all elements that contain data
+    *
+    * @param in: data   - const T type
+    * @param in: option - removal option (remove first of element or remove
+    *                                     all elements that contain data)
+    ******************************************************************************/
+    auto remove( const T &data, REMOVE_ENUM option = REMOVE_FIRST_OF ) -> void;
+    /***************************************************************************//**
+    * @brief : Remove all element of the list
+    *
+    * @param : none
+    ******************************************************************************/
+    auto clear() -> void;
+    /***************************************************************************//**
+    * @brief : remove first element of the list
+    *
+    * @param : none
+    ******************************************************************************/
+    auto popFront() -> void;
+    /***************************************************************************//**
+    * @brief : remove last element of the list
+    *
+    * @param : none
+    ******************************************************************************/
+    auto popBack() -> void;
+    /***************************************************************************//**
+    * @brief  : get current list size
+    *
+    * @param  :  none
+    * @return :  std::size_t - number of elements
+    ******************************************************************************/
+    auto size() const -> std::size_t;
+    /***************************************************************************//**
+    * @brief  : check if current list is empty
+    *
+    * @param  :  none
+    * @return :  bool - returns empty if size is equal to 0.
+    ******************************************************************************/
+    auto empty() const -> bool;
+    /***************************************************************************//**
+    * @brief  : Return first element of the current list
+    *
+    * @param  :  none
+    * @return :  T& - reference to the first element data
+    ******************************************************************************/
+    auto front() -> T&;
+    auto front() const -> const T&;
+    /***************************************************************************//**
+    * @brief  : Return last element of the current list
+    *
+    * @param  :  none
+    * @return :  T& - reference to the last element data
+    ******************************************************************************/
+    auto back() -> T&;
+    auto back() const -> const T&;
+    /***************************************************************************//**
+    * @brief  : Reverse the current list
+    *
+    * @param  :  none
+    ******************************************************************************/
+    auto reverse() -> void;
+    /***************************************************************************//**
+    * @brief  : Find position of the first element that contains data
+    *
+    * @param  in:  data - const T
+    * @return   :  index of the element, NOT_DEFINED if not found
+    ******************************************************************************/
+    auto find( const T &data ) const -> std::size_t;
+    /***************************************************************************//**
+    * @brief : Search index operator
+    *
+    * @param in:  index
+    * @return  :  Reference to data at position index
+    ******************************************************************************/
+    auto operator[] ( const std::size_t index ) -> T&;
+private:
+    static constexpr std::size_t CAPACITY = UnrolledNode<T>::CAPACITY;
+
+    UnrolledNode<T> *head {nullptr},
+                    *tail {nullptr};
+    std::size_t m_size {0};
+    std::mutex m_mutex;
+    NodePool<UnrolledNode<T>> m_pool;
+    /***************************************************************************//**
+    * @brief : Create an empty node and link it after prev
+    *
+    * @param in: prev - node to link after, nullptr links at the head
+    * @return  : new node
+    ******************************************************************************/
+    auto linkNode( UnrolledNode<T> *prev ) -> UnrolledNode<T>*;
+    /***************************************************************************//**
+    * @brief : Unlink an empty node and give it back to the pool
+    *
+    * @param in: node - node to release
+    ******************************************************************************/
+    auto unlinkNode( UnrolledNode<T> *node ) -> void;
+    /***************************************************************************//**
+    * @brief : Find the node holding element index
+    *
+    * @param in : index  - element position
+    * @param out: offset - position of the element inside the node
+    * @return   : node holding the element
+    ******************************************************************************/
+    auto locate( std::size_t index, std::size_t &offset ) const -> UnrolledNode<T>*;
+    /***************************************************************************//**
+    * @brief : Construct an element at offset of node, splitting the node if
+    *          it is full
+    *
+    * @param in: node   - target node
+    * @param in: offset - position inside the node
+    * @param in: args   - arguments forwarded to the constructor of T
+    * @return  : Reference to the new element
+    ******************************************************************************/
+    template < typename... Args >
+    auto insertAt( UnrolledNode<T> *node, std::size_t offset, Args&&... args ) -> T&;
+    /***************************************************************************//**
+    * @brief : Construct an element at position index, caller must hold m_mutex
+    *
+    * @param in: index - position of the new element, m_size appends
+    * @param in: args  - arguments forwarded to the constructor of T
+    * @return  : Reference to the new element
+    ******************************************************************************/
+    template < typename... Args >
+    auto insertIndex( const std::size_t index, Args&&... args ) -> T&;
+    /***************************************************************************//**
+    * @brief : Erase element at offset of node, merging with the next node when
+    *          both fit in one node
+    *
+    * @param in: node   - target node
+    * @param in: offset - position inside the node
+    ******************************************************************************/
+    auto eraseAt( UnrolledNode<T> *node, std::size_t offset ) -> void;
+    /***************************************************************************//**
+    * @brief : Move elements [from, count) of source to the end of destination
+    *
+    * @param in: source      - node losing the elements
+    * @param in: from        - first element to move
+    * @param in: destination - node receiving the elements
+    ******************************************************************************/
+    auto moveItems( UnrolledNode<T> *source, std::size_t from, UnrolledNode<T> *destination ) -> void;
+}; // class UnrolledLinkedList
+/***********************************************************
+ *                Functions definition
+************************************************************/
+template < typename T >
+constexpr std::size_t UnrolledLinkedList<T>::CAPACITY;
+
+template < typename T >
+UnrolledLinkedList<T>::~UnrolledLinkedList() {
+    removeUnrolledNodes(m_pool, head);
+    head = tail = nullptr;
+}
+
+template < typename T >
+auto UnrolledLinkedList<T>::add( const T &data ) -> void {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    insertIndex(m_size, data);
+}
+
+template < typename T >
+auto UnrolledLinkedList<T>::add( T &&data ) -> void {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    insertIndex(m_size, std::move(data));
+}
+
+template < typename T >
+auto UnrolledLinkedList<T>::addFront( const T &data ) -> void {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    insertIndex(0, data);
+}
+
+template < typename T >
+auto UnrolledLinkedList<T>::addFront( T &&data ) -> void {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    insertIndex(0, std::move(data));
+}
+
+template < typename T >
+auto UnrolledLinkedList<T>::insert( const T &data, const std::size_t index ) -> void {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if (index > m_size)
+        throw Exception("Index out of range");
+    insertIndex(index, data);
+}
+
+template < typename T >
+template < typename... Args >
+auto UnrolledLinkedList<T>::emplace_back( Args&&... args ) -> T& {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    return insertIndex(m_size, std::forward<Args>(args)...);
+}
+
+template < typename T >
+template < typename... Args >
+auto UnrolledLinkedList<T>::emplace_front( Args&&... args ) -> T& {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    return insertIndex(0, std::forward<Args>(args)...);
+}
+
+template < typename T >
+template < typename... Args >
+auto UnrolledLinkedList<T>::emplace( const std::size_t index, Args&&... args ) -> T& {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if (index > m_size)
+        throw Exception("Index out of range");
+    return insertIndex(index, std::forward<Args>(args)...);
+}
+
+template < typename T >
+template < typename... Args >
+auto UnrolledLinkedList<T>::insertIndex( const std::size_t index, Args&&... args ) -> T& {
+    UnrolledNode<T> *node = nullptr;
+    if (index == m_size && (nullptr == tail || CAPACITY == tail->count))
+        node = linkNode(tail);
+    else if (0 == index && CAPACITY == head->count)
+        node = linkNode(nullptr);
+    if (nullptr != node) {
+        try {
+            return insertAt(node, 0, std::forward<Args>(args)...);
+        } catch (...) {
+            // the constructor of T threw, the new node is still empty
+            unlinkNode(node);
+            throw;
+        }
+    }
+    if (index == m_size)
+        return insertAt(tail, tail->count, std::forward<Args>(args)...);
+    if (0 == index)
+        return insertAt(head, 0, std::forward<Args>(args)...);
+    std::size_t offset = 0;
+    node = locate(index, offset);
+    return insertAt(node, offset, std::forward<Args>(args)...);
+}
+
+template < typename T >
+auto UnrolledLinkedList<T>::remove( const T &data, REMOVE_ENUM option ) -> void {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    auto node = head;
+    std::size_t offset = 0;
+    while (nullptr != node) {
+        if (offset == node->count) {
+            node = node->next;
+            offset = 0;
+        } else if (node->at(offset) == data) {
+            auto next = node->next;
+            const bool last = (1 == node->count);
+            eraseAt(node, offset);
+            if (option == REMOVE_FIRST_OF) break;
+            if (last) {
+                node = next;
+                offset = 0;
+            }
+        } else {
+            offset++;
+        }
+    }
+}
+
+template < typename T >
+auto UnrolledLinkedList<T>::clear() -> void {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    removeUnrolledNodes(m_pool, head);
+    head = nullptr;
+    tail = nullptr;
+    m_size = 0;
+}
+
+template < typename T >
+auto UnrolledLinkedList<T>::popFront() -> void {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if (nullptr != head)
+        eraseAt(head, 0);
+}
+
+template < typename T >
+auto UnrolledLinkedList<T>::popBack() -> void {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if (nullptr != tail)
+        eraseAt(tail, tail->count - 1);
+}
+
+template < typename T >
+auto UnrolledLinkedList<T>::size() const -> std::size_t {
+    return m_size;
+}
+
+template < typename T >
+auto UnrolledLinkedList<T>::empty() const -> bool {
+    return (m_size == 0);
+}
+
+template < typename T >
+auto UnrolledLinkedList<T>::front() -> T& {
+    if (nullptr == head)
+        throw Exception("Access to a non allocated memory");
+    return head->at(0);
+}
+
+template < typename T >
+auto UnrolledLinkedList<T>::front() const -> const T& {
+    if (nullptr == head)
+        throw Exception("Access to a non allocated memory");
+    return head->at(0);
+}
+
+template < typename T >
+auto UnrolledLinkedList<T>::back() -> T& {
+    if (nullptr == tail)
+        throw Exception("Access to a non allocated memory");
+    return tail->at(tail->count - 1);
+}
+
+template < typename T >
+auto UnrolledLinkedList<T>::back() const -> const T& {
+    if (nullptr == tail)
+        throw Exception("Access to a non allocated memory");
+    return tail->at(tail->count - 1);
+}
+
+template < typename T >
+auto UnrolledLinkedList<T>::reverse() -> void {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    auto node = head;
+    while (nullptr != node) {
+        auto next = node->next;
+        std::swap(node->next, node->prev);
+        std::reverse(&node->at(0), &node->at(0) + node->count);
+        node = next;
+    }
+    std::swap(head, tail);
+}
+
+template < typename T >
+auto UnrolledLinkedList<T>::find( const T &data ) const -> std::size_t {
+    std::size_t index = 0;
+    for ( auto node = head; nullptr != node; node = node->next ) {
+        for ( std::size_t i(0); i < node->count; ++i, ++index ) {
+            if (node->at(i) == data)
+                return index;
+        }
+    }
+    return static_cast<std::size_t>(NOT_DEFINED);
+}
+
+template < typename T >
+auto UnrolledLinkedList<T>::operator[] ( const std::size_t index ) -> T& {
+    if (index >= m_size)
+        throw Exception("Index out of range");
+    std::size_t offset = 0;
+    auto node = locate(index, offset);
+    return node->at(offset);
+}
+
+template < typename T >
+auto UnrolledLinkedList<T>::linkNode( UnrolledNode<T> *prev ) -> UnrolledNode<T>* {
+    auto node = m_pool.create();
+    node->prev = prev;
+    node->next = (nullptr != prev) ? prev->next : head;
+    if (nullptr != node->next) node->next->prev = node;
+    else tail = node;
+    if (nullptr != prev) prev->next = node;
+    else head = node;
+    return node;
+}
+
+template < typename T >
+auto UnrolledLinkedList<T>::unlinkNode( UnrolledNode<T> *node ) -> void {
+    if (nullptr != node->prev) node->prev->next = node->next;
+    else head = node->next;
+    if (nullptr != node->next) node->next->prev = node->prev;
+    else tail = node->prev;
+    removeUnrolledNode(m_pool, node);
+}
+
+template < typename T >
+auto UnrolledLinkedList<T>::locate( std::size_t index, std::size_t &offset ) const -> UnrolledNode<T>* {
+    if (index >= m_size / 2) {
+        // walk backward from the tail when the element sits in the second half
+        auto remaining = m_size - index;
+        auto node = tail;
+        while (remaining > node->count) {
+            remaining -= node->count;
+            node = node->prev;
+        }
+        offset = node->count - remaining;
+        return node;
+    }
+    auto node = head;
+    while (index >= node->count) {
+        index -= node->count;
+        node = node->next;
+    }
+    offset = index;
+    return node;
+}
+
+template < typename T >
+template < typename... Args >
+auto UnrolledLinkedList<T>::insertAt( UnrolledNode<T> *node, std::size_t offset, Args&&... args ) -> T& {
+    if (CAPACITY == node->count) {
+        // built before the split, which moves the elements args may refer
+        // to, and so that a throwing constructor leaves the node untouched
+        T value(std::forward<Args>(args)...);
+        const std::size_t half = CAPACITY / 2;
+        auto next = linkNode(node);
+        moveItems(node, half, next);
+        if (offset > half) {
+            node = next;
+            offset -= half;
+        }
+        return insertAt(node, offset, std::move(value));
+    }
+    if (offset == node->count) {
+        ::new (static_cast<void*>(&node->items[offset])) T(std::forward<Args>(args)...);
+    } else {
+        T value(std::forward<Args>(args)...);
+        ::new (static_cast<void*>(&node->items[node->count])) T(std::move(node->at(node->count - 1)));
+        for ( auto i = node->count - 1; i > offset; --i )
+            node->at(i) = std::move(node->at(i - 1));
+        node->at(offset) = std::move(value);
+    }
+    node->count++;
+    m_size++;
+    return node->at(offset);
+}
+
+template < typename T >
+auto UnrolledLinkedList<T>::eraseAt( UnrolledNode<T> *node, std::size_t offset ) -> void {
+    for ( auto i = offset; i + 1 < node->count; ++i )
+        node->at(i) = std::move(node->at(i + 1));
+    node->at(node->count - 1).~T();
+    node->count--;
+    m_size--;
+    if (0 == node->count) {
+        unlinkNode(node);
+    } else {
+        auto next = node->next;
+        if (nullptr != next && node->count + next->count <= CAPACITY / 2) {
+            moveItems(next, 0, node);
+            unlinkNode(next);
+        }
+    }
+}
+
+template < typename T >
+auto UnrolledLinkedList<T>::moveItems( UnrolledNode<T> *source, std::size_t from, UnrolledNode<T> *destination ) -> void {
+    for ( auto i = from; i < source->count; ++i ) {
+        ::new (static_cast<void*>(&destination->items[destination->count++])) T(std::move(source->at(i)));
+        source->at(i).~T();
+    }
+    source->count = static_cast<std::uint32_t>(from);
+}
+
+#endif
@@ -0,0 +1,50 @@
+/** @file Crc32.hpp
+ *  @brief CRC-32 checksum (IEEE 802.3, reflected polynomial 0xEDB88320)
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+#ifndef CRC32_HPP_
+#define CRC32_HPP_
+
+/***********************************************************
+ *                   std includes
+***********************************************************/
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/** @brief : Lookup table of the byte-wise CRC-32, built once
+ */
+inline auto crc32Table() -> const std::array<std::uint32_t, 256>& {
+    static const auto table = [] {
+        std::array<std::uint32_t, 256> result {};
+        for ( std::uint32_t i(0); i < 256; ++i ) {
+            auto crc = i;
+            for ( auto bit(0); bit < 8; ++bit )
+                crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320u : crc >> 1;
+            result[i] = crc;
+        }
+        return result;
+    }();
+    return table;
+}
+
+/***************************************************************************//**
+* @brief : Checksum of a range of bytes
+*
+* @param in: data   - first byte
+* @param in: length - number of bytes
+* @param in: crc    - checksum of the bytes preceding data, to chain ranges
+* @return  : std::uint32_t - checksum of the bytes
+******************************************************************************/
+inline auto crc32( const void *data, const std::size_t length, std::uint32_t crc = 0 ) -> std::uint32_t {
+    const auto &table = crc32Table();
+    auto bytes = static_cast<const unsigned char*>(data);
+    crc = ~crc;
+    for ( std::size_t i(0); i < length; ++i )
+        crc = table[(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+#endif
@@ -0,0 +1,259 @@
+/** @file EpochDomain.hpp
+ *  @brief Class definition of epoch based reclamation for lock-free readers
+ *
+ *  A reader pins the global epoch for the duration of an operation
+ *  instead of publishing every node it visits, which suits traversals
+ *  that go through many nodes, like a tree descent. Unlinked nodes are
+ *  retired with the epoch they were unlinked in. The global epoch only
+ *  moves forward once every pinned thread has seen it, so a node
+ *  retired in epoch E is freed once the global epoch reaches E + 2:
+ *  no reader can still hold it by then.
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+#ifndef EPOCHDOMAIN_HPP_
+#define EPOCHDOMAIN_HPP_
+
+/***********************************************************
+ *                   std includes
+***********************************************************/
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/***********************************************************
+ *               internal includes
+***********************************************************/
+#include "constants.hpp"
+
+/** @class EpochDomain
+ *  @brief This class owns the global epoch, the epoch pinned by every
+ *         thread and the nodes waiting to be reclaimed.
+ */
+class EpochDomain final {
+public:
+    /** @struct Retired
+     *  @brief Node waiting for reclamation, the function freeing it and
+     *         the epoch it was retired in
+     */
+    struct Retired {
+        void *pointer;
+        void (*deleter)(void*);
+        std::uint64_t epoch;
+    }; // struct Retired
+    /** @struct Record
+     *  @brief Epoch pinned by one thread, 0 when it is outside of any
+     *         operation. A record is handed over to another thread once
+     *         its owner exits, retired nodes included.
+     */
+    struct Record {
+        std::atomic<bool> active {false};
+        std::atomic<std::uint64_t> epoch {0};
+        std::size_t depth {0};
+        std::vector<Retired> retired;
+        Record *next {nullptr};
+    }; // struct Record
+    /***************************************************************************//**
+    * @brief : Return the process wide domain
+    *
+    * @param : none
+    * @return: reference to the domain
+    ******************************************************************************/
+    static auto instance() -> EpochDomain&;
+    /***************************************************************************//**
+    * @brief : Destructor, frees every record and every retired node
+    *
+    * @param : none
+    ******************************************************************************/
+    ~EpochDomain();
+    /***************************************************************************//**
+    * @brief : Return the record owned by the calling thread
+    *
+    * @param : none
+    * @return: Record* - epoch slot of the calling thread
+    ******************************************************************************/
+    auto record() -> Record*;
+    /***************************************************************************//**
+    * @brief : Pin the current epoch, calls may nest
+    *
+    * @param in: rec - record of the calling thread
+    ******************************************************************************/
+    auto enter( Record *rec ) -> void;
+    /***************************************************************************//**
+    * @brief : Unpin the epoch when the outermost enter is left
+    *
+    * @param in: rec - record of the calling thread
+    ******************************************************************************/
+    auto leave( Record *rec ) -> void;
+    /***************************************************************************//**
+    * @brief : Hand a node over for deferred reclamation, the node must be
+    *          unreachable for readers entering from now on
+    *
+    * @param in: pointer - unlinked node
+    * @param in: deleter - function freeing the node
+    ******************************************************************************/
+    auto retire( void *pointer, void (*deleter)(void*) ) -> void;
+private:
+    std::atomic<Record*> m_records {nullptr};
+    alignas(CACHE_LINE_SIZE) std::atomic<std::uint64_t> m_epoch {1};
+
+    EpochDomain() = default;
+    /***************************************************************************//**
+    * @brief : Take a free record or append a new one
+    *
+    * @param : none
+    * @return: Record* - record now owned by the calling thread
+    ******************************************************************************/
+    auto acquire() -> Record*;
+    /***************************************************************************//**
+    * @brief : Move the global epoch forward if every pinned thread has seen it
+    *
+    * @param : none
+    * @return: std::uint64_t - global epoch after the attempt
+    ******************************************************************************/
+    auto advance() -> std::uint64_t;
+    /***************************************************************************//**
+    * @brief : Free the retired nodes of a record that no reader can hold
+    *
+    * @param in: rec - record of the calling thread
+    ******************************************************************************/
+    auto reclaim( Record *rec ) -> void;
+}; // class EpochDomain
+
+/** @class EpochGuard
+ *  @brief This class pins the epoch of the calling thread for its scope,
+ *         nodes read meanwhile are not freed
+ */
+class EpochGuard final {
+public:
+    /***************************************************************************//**
+    * @brief : Constructor
+    *
+    * @param : none
+    ******************************************************************************/
+    EpochGuard() : m_record(EpochDomain::instance().record()) {
+        EpochDomain::instance().enter(m_record);
+    }
+    /***************************************************************************//**
+    * @brief : Destructor
+    *
+    * @param : none
+    ******************************************************************************/
+    ~EpochGuard() { EpochDomain::instance().leave(m_record); }
+    EpochGuard( const EpochGuard & ) = delete;
+    auto operator=( const EpochGuard & ) -> EpochGuard& = delete;
+private:
+    EpochDomain::Record *m_record;
+}; // class EpochGuard
+
+template < typename N >
+/** @brief : function to retire a node allocated with new once the epoch
+ *           has moved on
+ *  @param in  : node - node unlinked from its container
+ *  @param out : none
+ */
+auto retireEpochNode( N *node ) -> void {
+    EpochDomain::instance().retire(const_cast<void*>(static_cast<const void*>(node)), [](void *pointer) {
+        delete static_cast<N*>(pointer);
+    });
+}
+/***********************************************************
+ *                Functions definition
+************************************************************/
+inline auto EpochDomain::instance() -> EpochDomain& {
+    static EpochDomain domain;
+    return domain;
+}
+
+inline EpochDomain::~EpochDomain() {
+    auto rec = m_records.load(std::memory_order_acquire);
+    while (nullptr != rec) {
+        auto next = rec->next;
+        for ( auto &r : rec->retired )
+            r.deleter(r.pointer);
+        delete rec;
+        rec = next;
+    }
+}
+
+inline auto EpochDomain::record() -> Record* {
+    /** @struct Owner
+     *  @brief Releases the record of a thread when the thread exits
+     */
+    struct Owner {
+        Record *rec {nullptr};
+        ~Owner() {
+            if (nullptr == rec) return;
+            rec->depth = 0;
+            rec->epoch.store(0, std::memory_order_release);
+            rec->active.store(false, std::memory_order_release);
+        }
+    }; // struct Owner
+    static thread_local Owner owner;
+    if (nullptr == owner.rec)
+        owner.rec = acquire();
+    return owner.rec;
+}
+
+inline auto EpochDomain::enter( Record *rec ) -> void {
+    if (0 != rec->depth++) return;
+    // seq_cst orders the pin before the loads of the protected structure,
+    // against the unlink and the epoch load of a writer
+    rec->epoch.store(m_epoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+}
+
+inline auto EpochDomain::leave( Record *rec ) -> void {
+    if (0 == --rec->depth)
+        rec->epoch.store(0, std::memory_order_release);
+}
+
+inline auto EpochDomain::acquire() -> Record* {
+    for ( auto rec = m_records.load(std::memory_order_acquire); nullptr != rec; rec = rec->next ) {
+        bool expected = false;
+        if (!rec->active.load(std::memory_order_relaxed) &&
+            rec->active.compare_exchange_strong(expected, true, std::memory_order_acquire))
+            return rec;
+    }
+    auto rec = new Record();
+    rec->active.store(true, std::memory_order_relaxed);
+    auto head = m_records.load(std::memory_order_relaxed);
+    do {
+        rec->next = head;
+    } while (!m_records.compare_exchange_weak(head, rec, std::memory_order_release,
+                                                         std::memory_order_relaxed));
+    return rec;
+}
+
+inline auto EpochDomain::retire( void *pointer, void (*deleter)(void*) ) -> void {
+    auto rec = record();
+    rec->retired.push_back(Retired{pointer, deleter, m_epoch.load(std::memory_order_seq_cst)});
+    if (rec->retired.size() >= EPOCH_SCAN_THRESHOLD)
+        reclaim(rec);
+}
+
+inline auto EpochDomain::advance() -> std::uint64_t {
+    auto epoch = m_epoch.load(std::memory_order_seq_cst);
+    for ( auto r = m_records.load(std::memory_order_acquire); nullptr != r; r = r->next ) {
+        const auto pinned = r->epoch.load(std::memory_order_seq_cst);
+        if (0 != pinned && epoch != pinned) return epoch;
+    }
+    // a failed exchange means another thread moved it forward
+    m_epoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst);
+    return m_epoch.load(std::memory_order_seq_cst);
+}
+
+inline auto EpochDomain::reclaim( Record *rec ) -> void {
+    const auto epoch = advance();
+    auto kept = rec->retired.begin();
+    for ( auto &r : rec->retired ) {
+        if (r.epoch + 2 > epoch)
+            *kept++ = r;
+        else
+            r.deleter(r.pointer);
+    }
+    rec->retired.erase(kept, rec->retired.end());
+}
+
+#endif
@@ -0,0 +1,238 @@
+/** @file HazardPointer.hpp
+ *  @brief Class definition of hazard pointers for lock-free containers
+ *
+ *  A thread publishes the nodes it is about to dereference in its
+ *  hazard slots. Unlinked nodes are retired instead of deleted and
+ *  only freed once no hazard slot of any thread refers to them.
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+#ifndef HAZARDPOINTER_HPP_
+#define HAZARDPOINTER_HPP_
+
+/***********************************************************
+ *                   std includes
+***********************************************************/
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+/***********************************************************
+ *               internal includes
+***********************************************************/
+#include "constants.hpp"
+
+/** @class HazardPointerDomain
+ *  @brief This class owns the hazard slots of every thread and
+ *         the nodes waiting to be reclaimed.
+ */
+class HazardPointerDomain final {
+public:
+    /** @struct Retired
+     *  @brief Node waiting for reclamation and the function freeing it
+     */
+    struct Retired {
+        void *pointer;
+        void (*deleter)(void*);
+    }; // struct Retired
+    /** @struct Record
+     *  @brief Hazard slots of one thread. A record is handed over to
+     *         another thread once its owner exits, retired nodes included.
+     */
+    struct Record {
+        std::atomic<bool> active {false};
+        std::atomic<void*> hazard[HAZARD_POINTERS_PER_THREAD] {};
+        std::vector<Retired> retired;
+        Record *next {nullptr};
+    }; // struct Record
+    /***************************************************************************//**
+    * @brief : Return the process wide domain
+    *
+    * @param : none
+    * @return: reference to the domain
+    ******************************************************************************/
+    static auto instance() -> HazardPointerDomain&;
+    /***************************************************************************//**
+    * @brief : Destructor, frees every record and every retired node
+    *
+    * @param : none
+    ******************************************************************************/
+    ~HazardPointerDomain();
+    /***************************************************************************//**
+    * @brief : Return the record owned by the calling thread
+    *
+    * @param : none
+    * @return: Record* - hazard slots of the calling thread
+    ******************************************************************************/
+    auto record() -> Record*;
+    /***************************************************************************//**
+    * @brief : Hand a node over for deferred reclamation
+    *
+    * @param in: pointer - unlinked node
+    * @param in: deleter - function freeing the node
+    ******************************************************************************/
+    auto retire( void *pointer, void (*deleter)(void*) ) -> void;
+private:
+    std::atomic<Record*> m_records {nullptr};
+    std::atomic<std::size_t> m_count {0};
+
+    HazardPointerDomain() = default;
+    /***************************************************************************//**
+    * @brief : Take a free record or append a new one
+    *
+    * @param : none
+    * @return: Record* - record now owned by the calling thread
+    ******************************************************************************/
+    auto acquire() -> Record*;
+    /***************************************************************************//**
+    * @brief : Free the retired nodes of a record that are no longer hazardous
+    *
+    * @param in: rec - record of the calling thread
+    ******************************************************************************/
+    auto scan( Record *rec ) -> void;
+}; // class HazardPointerDomain
+
+/** @class HazardPointer
+ *  @brief This class is a scoped hazard slot of the calling thread,
+ *         cleared when it goes out of scope
+ */
+class HazardPointer final {
+public:
+    /***************************************************************************//**
+    * @brief : Constructor
+    *
+    * @param in: slot - index of the hazard slot, < HAZARD_POINTERS_PER_THREAD
+    ******************************************************************************/
+    explicit HazardPointer( const std::size_t slot ) :
+        m_hazard(HazardPointerDomain::instance().record()->hazard[slot]) {}
+    /***************************************************************************//**
+    * @brief : Destructor
+    *
+    * @param : none
+    ******************************************************************************/
+    ~HazardPointer() { reset(); }
+    HazardPointer( const HazardPointer & ) = delete;
+    auto operator=( const HazardPointer & ) -> HazardPointer& = delete;
+    /***************************************************************************//**
+    * @brief : Load source and publish it until the published value is stable
+    *
+    * @param in: source - atomic pointer to protect
+    * @return  : protected pointer
+    ******************************************************************************/
+    template < typename N >
+    auto protect( const std::atomic<N*> &source ) -> N* {
+        auto pointer = source.load(std::memory_order_relaxed);
+        while (true) {
+            m_hazard.store(pointer, std::memory_order_seq_cst);
+            auto current = source.load(std::memory_order_seq_cst);
+            if (current == pointer) return pointer;
+            pointer = current;
+        }
+    }
+    /***************************************************************************//**
+    * @brief : Clear the hazard slot
+    *
+    * @param : none
+    ******************************************************************************/
+    auto reset() -> void { m_hazard.store(nullptr, std::memory_order_release); }
+private:
+    std::atomic<void*> &m_hazard;
+}; // class HazardPointer
+
+template < typename N >
+/** @brief : function to retire a node allocated with new
+ *  @param in  : node - node unlinked from its container
+ *  @param out : none
+ */
+auto retireNode( N *node ) -> void {
+    HazardPointerDomain::instance().retire(node, [](void *pointer) {
+        delete static_cast<N*>(pointer);
+    });
+}
+/***********************************************************
+ *                Functions definition
+************************************************************/
+inline auto HazardPointerDomain::instance() -> HazardPointerDomain& {
+    static HazardPointerDomain domain;
+    return domain;
+}
+
+inline HazardPointerDomain::~HazardPointerDomain() {
+    auto rec = m_records.load(std::memory_order_acquire);
+    while (nullptr != rec) {
+        auto next = rec->next;
+        for ( auto &r : rec->retired )
+            r.deleter(r.pointer);
+        delete rec;
+        rec = next;
+    }
+}
+
+inline auto HazardPointerDomain::record() -> Record* {
+    /** @struct Owner
+     *  @brief Releases the record of a thread when the thread exits
+     */
+    struct Owner {
+        Record *rec {nullptr};
+        ~Owner() {
+            if (nullptr == rec) return;
+            for ( auto &h : rec->hazard )
+                h.store(nullptr, std::memory_order_relaxed);
+            rec->active.store(false, std::memory_order_release);
+        }
+    }; // struct Owner
+    static thread_local Owner owner;
+    if (nullptr == owner.rec)
+        owner.rec = acquire();
+    return owner.rec;
+}
+
+inline auto HazardPointerDomain::acquire() -> Record* {
+    for ( auto rec = m_records.load(std::memory_order_acquire); nullptr != rec; rec = rec->next ) {
+        bool expected = false;
+        if (!rec->active.load(std::memory_order_relaxed) &&
+            rec->active.compare_exchange_strong(expected, true, std::memory_order_acquire))
+            return rec;
+    }
+    auto rec = new Record();
+    rec->active.store(true, std::memory_order_relaxed);
+    auto head = m_records.load(std::memory_order_relaxed);
+    do {
+        rec->next = head;
+    } while (!m_records.compare_exchange_weak(head, rec, std::memory_order_release,
+                                                         std::memory_order_relaxed));
+    m_count.fetch_add(1, std::memory_order_relaxed);
+    return rec;
+}
+
+inline auto HazardPointerDomain::retire( void *pointer, void (*deleter)(void*) ) -> void {
+    auto rec = record();
+    rec->retired.push_back(Retired{pointer, deleter});
+    const auto threshold = HAZARD_SCAN_THRESHOLD +
+        2 * HAZARD_POINTERS_PER_THREAD * m_count.load(std::memory_order_relaxed);
+    if (rec->retired.size() >= threshold)
+        scan(rec);
+}
+
+inline auto HazardPointerDomain::scan( Record *rec ) -> void {
+    std::vector<void*> hazards;
+    for ( auto r = m_records.load(std::memory_order_acquire); nullptr != r; r = r->next ) {
+        for ( auto &h : r->hazard ) {
+            auto pointer = h.load(std::memory_order_seq_cst);
+            if (nullptr != pointer) hazards.push_back(pointer);
+        }
+    }
+    std::sort(hazards.begin(), hazards.end());
+    auto kept = rec->retired.begin();
+    for ( auto &r : rec->retired ) {
+        if (std::binary_search(hazards.begin(), hazards.end(), r.pointer))
+            *kept++ = r;
+        else
+            r.deleter(r.pointer);
+    }
+    rec->retired.erase(kept, rec->retired.end());
+}
+
+#endif
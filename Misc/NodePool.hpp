@@ -0,0 +1,246 @@
+/** @file NodePool.hpp
+ *  @brief Class definition of a slab allocator for container nodes
+ *
+ *  NodePool hands out node storage from chunks of growing size
+ *  and recycles released nodes through an intrusive free list.
+ *  All chunks are returned to the heap at once by clear(), which
+ *  lets a container drop a large number of nodes in O(chunks).
+ *  The free list holds runs of contiguous slots rather than single
+ *  slots, and both lists know their tail, so merge() takes over
+ *  another pool with a few pointer swaps whatever its size.
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+#ifndef NODEPOOL_HPP_
+#define NODEPOOL_HPP_
+
+/***********************************************************
+ *                   std includes
+***********************************************************/
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/***********************************************************
+ *               internal includes
+***********************************************************/
+#include "constants.hpp"
+
+template < typename N >
+/** @class NodePool
+ *  @brief This class define a chunked pool of nodes of type N.
+ *
+ *  A pool is owned by a single container and is not synchronized:
+ *  the owning container serializes access to it.
+ */
+class NodePool final {
+public:
+    /***************************************************************************//**
+    * @brief : Constructor
+    *
+    * @param : none
+    ******************************************************************************/
+    NodePool() = default;
+    /***************************************************************************//**
+    * @brief : Destructor, returns all chunks to the heap. Nodes still alive
+    *          are not destroyed.
+    *
+    * @param : none
+    ******************************************************************************/
+    ~NodePool();
+    NodePool( const NodePool & ) = delete;
+    auto operator=( const NodePool & ) -> NodePool& = delete;
+    /***************************************************************************//**
+    * @brief : Construct a new node in the pool
+    *
+    * @param in: args - arguments forwarded to the node constructor
+    * @return  : N*   - pointer to the new node
+    ******************************************************************************/
+    template < typename... Args >
+    auto create( Args&&... args ) -> N*;
+    /***************************************************************************//**
+    * @brief : Destroy a node and give its storage back to the free list
+    *
+    * @param in: node - node previously returned by create()
+    ******************************************************************************/
+    auto destroy( N *node ) -> void;
+    /***************************************************************************//**
+    * @brief : Return every chunk to the heap. Nodes are not destroyed, the
+    *          caller must have destroyed the non trivially destructible ones.
+    *
+    * @param : none
+    ******************************************************************************/
+    auto clear() -> void;
+    /***************************************************************************//**
+    * @brief : Take over every chunk of another pool in O(1), nodes living
+    *          in other become owned by this pool and other is left empty
+    *
+    * @param in: other - pool to empty
+    ******************************************************************************/
+    auto merge( NodePool &other ) -> void;
+private:
+    union Slot;
+    /** @struct Run
+     *  @brief Free list link held by the first slot of a run of free slots
+     */
+    struct Run {
+        Slot *next;
+        Slot *end;
+    }; // struct Run
+    /** @union Slot
+     *  @brief Storage of one node, reused as free list link once released
+     */
+    union Slot {
+        Run run;
+        typename std::aligned_storage<sizeof(N), alignof(N)>::type storage;
+    }; // union Slot
+    /** @struct Chunk
+     *  @brief Header of a block of slots allocated in one piece
+     */
+    struct Chunk {
+        Chunk *next;
+    }; // struct Chunk
+
+    Chunk *m_chunks {nullptr},
+          *m_chunksTail {nullptr};
+    Slot *m_freeList {nullptr},
+         *m_freeTail {nullptr},
+         *m_cursor {nullptr},
+         *m_end {nullptr};
+    std::size_t m_nextChunkSize {NODE_POOL_MIN_CHUNK};
+    /***************************************************************************//**
+    * @brief : Allocate a new chunk and make it the bump allocation area
+    *
+    * @param : none
+    ******************************************************************************/
+    auto grow() -> void;
+    /***************************************************************************//**
+    * @brief : Take the first slot of the free list
+    *
+    * @param : none
+    * @return: Slot* - free slot, the free list must not be empty
+    ******************************************************************************/
+    auto take() -> Slot*;
+    /***************************************************************************//**
+    * @brief : Push a run of contiguous free slots on the free list
+    *
+    * @param in: first - first slot of the run
+    * @param in: end   - one past the last slot of the run
+    ******************************************************************************/
+    auto release( Slot *first, Slot *end ) -> void;
+}; // class NodePool
+/***********************************************************
+ *                Functions definition
+************************************************************/
+template < typename N >
+NodePool<N>::~NodePool() {
+    clear();
+}
+
+template < typename N >
+template < typename... Args >
+auto NodePool<N>::create( Args&&... args ) -> N* {
+    Slot *slot = nullptr;
+    if (nullptr != m_freeList) {
+        slot = take();
+    } else {
+        if (m_cursor == m_end) grow();
+        slot = m_cursor++;
+    }
+    try {
+        return ::new (static_cast<void*>(slot)) N(std::forward<Args>(args)...);
+    } catch (...) {
+        release(slot, slot + 1);
+        throw;
+    }
+}
+
+template < typename N >
+auto NodePool<N>::destroy( N *node ) -> void {
+    if (nullptr == node) return;
+    node->~N();
+    auto slot = reinterpret_cast<Slot*>(node);
+    release(slot, slot + 1);
+}
+
+template < typename N >
+auto NodePool<N>::clear() -> void {
+    while (nullptr != m_chunks) {
+        auto chunk = m_chunks;
+        m_chunks = chunk->next;
+        ::operator delete(chunk);
+    }
+    m_chunksTail = nullptr;
+    m_freeList = m_freeTail = m_cursor = m_end = nullptr;
+    m_nextChunkSize = NODE_POOL_MIN_CHUNK;
+}
+
+template < typename N >
+auto NodePool<N>::merge( NodePool &other ) -> void {
+    if (this == &other || nullptr == other.m_chunks) return;
+    other.m_chunksTail->next = m_chunks;
+    if (nullptr == m_chunks) m_chunksTail = other.m_chunksTail;
+    m_chunks = other.m_chunks;
+    // keep the larger bump area, the other one becomes a single free run
+    if ((m_end - m_cursor) < (other.m_end - other.m_cursor)) {
+        std::swap(m_cursor, other.m_cursor);
+        std::swap(m_end, other.m_end);
+    }
+    if (other.m_cursor != other.m_end)
+        other.release(other.m_cursor, other.m_end);
+    if (nullptr != other.m_freeList) {
+        other.m_freeTail->run.next = m_freeList;
+        if (nullptr == m_freeList) m_freeTail = other.m_freeTail;
+        m_freeList = other.m_freeList;
+    }
+    if (other.m_nextChunkSize > m_nextChunkSize)
+        m_nextChunkSize = other.m_nextChunkSize;
+    other.m_chunks = other.m_chunksTail = nullptr;
+    other.m_freeList = other.m_freeTail = other.m_cursor = other.m_end = nullptr;
+    other.m_nextChunkSize = NODE_POOL_MIN_CHUNK;
+}
+
+template < typename N >
+auto NodePool<N>::grow() -> void {
+    const auto count = m_nextChunkSize;
+    auto chunk = static_cast<Chunk*>(::operator new(sizeof(Chunk) + alignof(Slot) + count * sizeof(Slot)));
+    chunk->next = m_chunks;
+    if (nullptr == m_chunks) m_chunksTail = chunk;
+    m_chunks = chunk;
+    // slots may be over-aligned (cache line sized nodes), align them by hand
+    auto first = reinterpret_cast<std::uintptr_t>(chunk + 1);
+    first = (first + alignof(Slot) - 1) / alignof(Slot) * alignof(Slot);
+    m_cursor = reinterpret_cast<Slot*>(first);
+    m_end = m_cursor + count;
+    if (m_nextChunkSize < NODE_POOL_MAX_CHUNK)
+        m_nextChunkSize *= 2;
+}
+
+template < typename N >
+auto NodePool<N>::take() -> Slot* {
+    auto slot = m_freeList;
+    auto rest = slot + 1;
+    if (rest != slot->run.end) {
+        // the rest of the run keeps its place in the list
+        rest->run = slot->run;
+        m_freeList = rest;
+        if (m_freeTail == slot) m_freeTail = rest;
+    } else {
+        m_freeList = slot->run.next;
+        if (nullptr == m_freeList) m_freeTail = nullptr;
+    }
+    return slot;
+}
+
+template < typename N >
+auto NodePool<N>::release( Slot *first, Slot *end ) -> void {
+    first->run.next = m_freeList;
+    first->run.end = end;
+    if (nullptr == m_freeList) m_freeTail = first;
+    m_freeList = first;
+}
+
+#endif
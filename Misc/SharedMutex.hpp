@@ -0,0 +1,140 @@
+/** @file SharedMutex.hpp
+ *  @brief Class definition of a writer preferring reader-writer lock
+ *
+ *  std::shared_timed_mutex lets new readers in while a writer waits,
+ *  so a steady flow of readers starves writers forever. SharedMutex
+ *  holds new readers back as soon as a writer waits. It meets the
+ *  Lockable and SharedLockable requirements and is used through
+ *  std::lock_guard, std::shared_lock and std::lock.
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+#ifndef SHAREDMUTEX_HPP_
+#define SHAREDMUTEX_HPP_
+
+/***********************************************************
+ *                   std includes
+***********************************************************/
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+
+/** @class SharedMutex
+ *  @brief This class define a reader-writer lock giving priority to
+ *         writers. It is not recursive: a thread owning it in any mode
+ *         must not lock it again.
+ */
+class SharedMutex final {
+public:
+    /***************************************************************************//**
+    * @brief : Constructor
+    *
+    * @param : none
+    ******************************************************************************/
+    SharedMutex() = default;
+    /***************************************************************************//**
+    * @brief : Destructor
+    *
+    * @param : none
+    ******************************************************************************/
+    ~SharedMutex() = default;
+    SharedMutex( const SharedMutex & ) = delete;
+    auto operator=( const SharedMutex & ) -> SharedMutex& = delete;
+    /***************************************************************************//**
+    * @brief : Take exclusive ownership, waits for current readers to leave
+    *
+    * @param : none
+    ******************************************************************************/
+    auto lock() -> void;
+    /***************************************************************************//**
+    * @brief : Take exclusive ownership if nobody owns the lock
+    *
+    * @param : none
+    * @return: true if ownership was taken
+    ******************************************************************************/
+    auto try_lock() -> bool;
+    /***************************************************************************//**
+    * @brief : Release exclusive ownership
+    *
+    * @param : none
+    ******************************************************************************/
+    auto unlock() -> void;
+    /***************************************************************************//**
+    * @brief : Take shared ownership, waits while a writer owns or waits for
+    *          the lock
+    *
+    * @param : none
+    ******************************************************************************/
+    auto lock_shared() -> void;
+    /***************************************************************************//**
+    * @brief : Take shared ownership if no writer owns or waits for the lock
+    *
+    * @param : none
+    * @return: true if ownership was taken
+    ******************************************************************************/
+    auto try_lock_shared() -> bool;
+    /***************************************************************************//**
+    * @brief : Release shared ownership
+    *
+    * @param : none
+    ******************************************************************************/
+    auto unlock_shared() -> void;
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_readers, m_writers;
+    std::size_t m_activeReaders {0},
+                m_waitingWriters {0};
+    bool m_writing {false};
+}; // class SharedMutex
+/***********************************************************
+ *                Functions definition
+************************************************************/
+inline auto SharedMutex::lock() -> void {
+    std::unique_lock<std::mutex> guard(m_mutex);
+    m_waitingWriters++;
+    m_writers.wait(guard, [this]() { return !m_writing && 0 == m_activeReaders; });
+    m_waitingWriters--;
+    m_writing = true;
+}
+
+inline auto SharedMutex::try_lock() -> bool {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if (m_writing || 0 != m_activeReaders) return false;
+    m_writing = true;
+    return true;
+}
+
+inline auto SharedMutex::unlock() -> void {
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        m_writing = false;
+    }
+    // waiting writers go first, readers are released only when none is left
+    m_writers.notify_one();
+    m_readers.notify_all();
+}
+
+inline auto SharedMutex::lock_shared() -> void {
+    std::unique_lock<std::mutex> guard(m_mutex);
+    m_readers.wait(guard, [this]() { return !m_writing && 0 == m_waitingWriters; });
+    m_activeReaders++;
+}
+
+inline auto SharedMutex::try_lock_shared() -> bool {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if (m_writing || 0 != m_waitingWriters) return false;
+    m_activeReaders++;
+    return true;
+}
+
+inline auto SharedMutex::unlock_shared() -> void {
+    bool last = false;
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        last = (0 == --m_activeReaders);
+    }
+    if (last) m_writers.notify_one();
+}
+
+#endif
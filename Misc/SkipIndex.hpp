@@ -0,0 +1,251 @@
+/** @file SkipIndex.hpp
+ *  @brief Class definition of a positional skip list index
+ *
+ *  SkipIndex keeps a few express lanes over the nodes of a doubly
+ *  linked list. Each lane link stores how many list nodes it spans,
+ *  so the node at a given position is reached in O(log n) and the
+ *  lanes are updated in O(log n) when a node is linked or unlinked.
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+#ifndef SKIPINDEX_HPP_
+#define SKIPINDEX_HPP_
+
+/***********************************************************
+ *                   std includes
+***********************************************************/
+#include <cstddef>
+#include <cstdint>
+
+/***********************************************************
+ *               internal includes
+***********************************************************/
+#include "node.hpp"
+#include "NodePool.hpp"
+#include "constants.hpp"
+
+template < typename T >
+/** @class SkipIndex
+ *  @brief This class define a positional index over Node<T> chains.
+ *
+ *  Positions handed to the index are those of the list at the time
+ *  of the call. The index is not synchronized, the owning list is.
+ */
+class SkipIndex final {
+public:
+    /***************************************************************************//**
+    * @brief : Constructor
+    *
+    * @param : none
+    ******************************************************************************/
+    SkipIndex();
+    /***************************************************************************//**
+    * @brief : Destructor
+    *
+    * @param : none
+    ******************************************************************************/
+    ~SkipIndex() = default;
+    SkipIndex( const SkipIndex & ) = delete;
+    auto operator=( const SkipIndex & ) -> SkipIndex& = delete;
+    /***************************************************************************//**
+    * @brief : Drop all lanes, the index then describes an empty list
+    *
+    * @param : none
+    ******************************************************************************/
+    auto clear() -> void;
+    /***************************************************************************//**
+    * @brief : Rebuild all lanes over a whole chain in O(n)
+    *
+    * @param in: head - first node of the chain
+    * @param in: size - number of nodes of the chain
+    ******************************************************************************/
+    auto build( Node<T> *head, const std::size_t size ) -> void;
+    /***************************************************************************//**
+    * @brief : Find the node at a position
+    *
+    * @param in: head  - first node of the chain
+    * @param in: index - position of the node, must be lower than the size
+    * @return  : Node<T>* - node at position index
+    ******************************************************************************/
+    auto at( Node<T> *head, const std::size_t index ) const -> Node<T>*;
+    /***************************************************************************//**
+    * @brief : Record that node was linked at position index
+    *
+    * @param in: index - position of the new node
+    * @param in: node  - the new node
+    ******************************************************************************/
+    auto inserted( const std::size_t index, Node<T> *node ) -> void;
+    /***************************************************************************//**
+    * @brief : Record that the node at position index was unlinked
+    *
+    * @param in: index - position of the removed node
+    ******************************************************************************/
+    auto erased( const std::size_t index ) -> void;
+private:
+    /** @struct Lane
+     *  @brief Express lane link. The lane heads stand at position 0 and
+     *         list node i at position i + 1, width is the distance to
+     *         the next link (or to the end of the list)
+     */
+    struct Lane {
+        Node<T> *node {nullptr};
+        Lane *next {nullptr}, *down {nullptr};
+        std::size_t width {1};
+    }; // struct Lane
+
+    Lane m_heads[SKIP_INDEX_MAX_LEVEL];
+    std::size_t m_levels {0};
+    std::uint64_t m_seed {0x9E3779B97F4A7C15ULL};
+    NodePool<Lane> m_pool;
+    /***************************************************************************//**
+    * @brief : Draw the number of lanes of a new node, each extra lane with
+    *          probability 1/4
+    *
+    * @param : none
+    * @return: number of lanes, 0 if the node is not indexed
+    ******************************************************************************/
+    auto randomLevel() -> std::size_t;
+}; // class SkipIndex
+/***********************************************************
+ *                Functions definition
+************************************************************/
+template < typename T >
+SkipIndex<T>::SkipIndex() {
+    for ( std::size_t l(1); l < SKIP_INDEX_MAX_LEVEL; ++l )
+        m_heads[l].down = &m_heads[l - 1];
+}
+
+template < typename T >
+auto SkipIndex<T>::clear() -> void {
+    for ( auto &head : m_heads ) {
+        head.next = nullptr;
+        head.width = 1;
+    }
+    m_levels = 0;
+    m_pool.clear();
+}
+
+template < typename T >
+auto SkipIndex<T>::build( Node<T> *head, const std::size_t size ) -> void {
+    clear();
+    Lane *last[SKIP_INDEX_MAX_LEVEL];
+    std::size_t lastPos[SKIP_INDEX_MAX_LEVEL];
+    for ( std::size_t l(0); l < SKIP_INDEX_MAX_LEVEL; ++l ) {
+        last[l] = &m_heads[l];
+        lastPos[l] = 0;
+    }
+    std::size_t pos = 1;
+    for ( auto node = head; nullptr != node; node = node->next, ++pos ) {
+        const auto level = randomLevel();
+        Lane *below = nullptr;
+        for ( std::size_t l(0); l < level; ++l ) {
+            auto lane = m_pool.create();
+            lane->node = node;
+            lane->down = below;
+            last[l]->next = lane;
+            last[l]->width = pos - lastPos[l];
+            last[l] = lane;
+            lastPos[l] = pos;
+            below = lane;
+        }
+        if (level > m_levels) m_levels = level;
+    }
+    for ( std::size_t l(0); l < SKIP_INDEX_MAX_LEVEL; ++l )
+        last[l]->width = size + 1 - lastPos[l];
+}
+
+template < typename T >
+auto SkipIndex<T>::at( Node<T> *head, const std::size_t index ) const -> Node<T>* {
+    const auto target = index + 1;
+    std::size_t pos = 0;
+    const Lane *lane = &m_heads[(m_levels > 0) ? m_levels - 1 : 0];
+    while (true) {
+        while (nullptr != lane->next && pos + lane->width <= target) {
+            pos += lane->width;
+            lane = lane->next;
+        }
+        if (pos == target) return lane->node;
+        if (nullptr == lane->down) break;
+        lane = lane->down;
+    }
+    auto node = (0 == pos) ? head : lane->node->next;
+    for ( auto i = (0 == pos) ? 1 : pos + 1; i < target; ++i )
+        node = node->next;
+    return node;
+}
+
+template < typename T >
+auto SkipIndex<T>::inserted( const std::size_t index, Node<T> *node ) -> void {
+    const auto target = index + 1;
+    const auto level = randomLevel();
+    if (level > m_levels) m_levels = level;
+    const auto levels = (m_levels > 0) ? m_levels : 1;
+    std::size_t pos = 0;
+    Lane *lane = &m_heads[levels - 1];
+    Lane *above = nullptr;
+    for ( auto l = levels; l > 0; --l ) {
+        while (nullptr != lane->next && pos + lane->width < target) {
+            pos += lane->width;
+            lane = lane->next;
+        }
+        if (l <= level) {
+            auto created = m_pool.create();
+            created->node = node;
+            created->next = lane->next;
+            created->width = pos + lane->width + 1 - target;
+            lane->next = created;
+            lane->width = target - pos;
+            if (nullptr != above) above->down = created;
+            above = created;
+        } else {
+            lane->width++;
+        }
+        lane = lane->down;
+    }
+    // unused lanes are empty and span the whole list
+    for ( auto l = levels; l < SKIP_INDEX_MAX_LEVEL; ++l )
+        m_heads[l].width++;
+}
+
+template < typename T >
+auto SkipIndex<T>::erased( const std::size_t index ) -> void {
+    const auto target = index + 1;
+    const auto levels = (m_levels > 0) ? m_levels : 1;
+    std::size_t pos = 0;
+    Lane *lane = &m_heads[levels - 1];
+    for ( auto l = levels; l > 0; --l ) {
+        while (nullptr != lane->next && pos + lane->width < target) {
+            pos += lane->width;
+            lane = lane->next;
+        }
+        auto next = lane->next;
+        if (nullptr != next && pos + lane->width == target) {
+            lane->width += next->width - 1;
+            lane->next = next->next;
+            m_pool.destroy(next);
+        } else {
+            lane->width--;
+        }
+        lane = lane->down;
+    }
+    for ( auto l = levels; l < SKIP_INDEX_MAX_LEVEL; ++l )
+        m_heads[l].width--;
+}
+
+template < typename T >
+auto SkipIndex<T>::randomLevel() -> std::size_t {
+    // xorshift64*, two bits per level gives a 1/4 promotion probability
+    m_seed ^= m_seed >> 12;
+    m_seed ^= m_seed << 25;
+    m_seed ^= m_seed >> 27;
+    auto bits = m_seed * 0x2545F4914F6CDD1DULL;
+    std::size_t level = 0;
+    while (level < SKIP_INDEX_MAX_LEVEL && 0 == (bits & 3)) {
+        level++;
+        bits >>= 2;
+    }
+    return level;
+}
+
+#endif
@@ -0,0 +1,157 @@
+/** @file WaitStrategy.hpp
+ *  @brief Wait strategies of the blocking operations of lock-free
+ *         containers
+ *
+ *  A strategy blocks a thread until a condition holds and is told
+ *  by the container whenever that condition may have changed.
+ *  BusySpinWait burns its core for the lowest latency, SpinYieldWait
+ *  hands the core back to the scheduler after a short spin and
+ *  ParkWait sleeps on a condition variable after a short spin.
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+#ifndef WAITSTRATEGY_HPP_
+#define WAITSTRATEGY_HPP_
+
+/***********************************************************
+ *                   std includes
+***********************************************************/
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+
+/***********************************************************
+ *               internal includes
+***********************************************************/
+#include "constants.hpp"
+
+/** @brief : Tell the processor the thread is spinning
+ */
+inline auto cpuRelax() -> void {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+
+/** @struct BusySpinWait
+ *  @brief Spin until the condition holds, never leaves the core
+ */
+struct BusySpinWait final {
+    /***************************************************************************//**
+    * @brief : Block until ready() returns true
+    *
+    * @param in: ready - condition to wait for
+    ******************************************************************************/
+    template < typename Ready >
+    auto wait( Ready ready ) -> void {
+        while (!ready())
+            cpuRelax();
+    }
+    /***************************************************************************//**
+    * @brief : Block until ready() returns true or deadline is reached
+    *
+    * @param in: ready    - condition to wait for
+    * @param in: deadline - time after which the wait fails
+    * @return  : false if the deadline was reached first
+    ******************************************************************************/
+    template < typename Ready, typename Clock, typename Duration >
+    auto waitUntil( Ready ready, const std::chrono::time_point<Clock, Duration> &deadline ) -> bool {
+        for ( std::size_t spin(0); !ready(); ++spin ) {
+            // reading the clock costs more than a pause, do it once in a while
+            if (0 == spin % WAIT_SPIN_LIMIT && Clock::now() >= deadline) return ready();
+            cpuRelax();
+        }
+        return true;
+    }
+    /***************************************************************************//**
+    * @brief : The condition of a waiter may have changed
+    *
+    * @param : none
+    ******************************************************************************/
+    auto notify() -> void {}
+}; // struct BusySpinWait
+
+/** @struct SpinYieldWait
+ *  @brief Spin WAIT_SPIN_LIMIT times, then yield the core between checks
+ */
+struct SpinYieldWait final {
+    template < typename Ready >
+    auto wait( Ready ready ) -> void {
+        for ( std::size_t spin(0); !ready(); ++spin ) {
+            if (spin < WAIT_SPIN_LIMIT) cpuRelax();
+            else std::this_thread::yield();
+        }
+    }
+    template < typename Ready, typename Clock, typename Duration >
+    auto waitUntil( Ready ready, const std::chrono::time_point<Clock, Duration> &deadline ) -> bool {
+        for ( std::size_t spin(0); !ready(); ++spin ) {
+            if (spin < WAIT_SPIN_LIMIT) {
+                cpuRelax();
+                continue;
+            }
+            if (Clock::now() >= deadline) return ready();
+            std::this_thread::yield();
+        }
+        return true;
+    }
+    auto notify() -> void {}
+}; // struct SpinYieldWait
+
+/** @class ParkWait
+ *  @brief Spin WAIT_SPIN_LIMIT times, then sleep on a condition variable.
+ *         notify() only takes the mutex when a thread sleeps.
+ */
+class ParkWait final {
+public:
+    template < typename Ready >
+    auto wait( Ready ready ) -> void {
+        if (spin(ready)) return;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_sleepers.fetch_add(1);
+        // pairs with the fence of notify(): either the notifier sees a
+        // sleeper or ready() sees what the notifier published
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        m_cond.wait(lock, ready);
+        m_sleepers.fetch_sub(1);
+    }
+    template < typename Ready, typename Clock, typename Duration >
+    auto waitUntil( Ready ready, const std::chrono::time_point<Clock, Duration> &deadline ) -> bool {
+        if (spin(ready)) return true;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_sleepers.fetch_add(1);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const bool done = m_cond.wait_until(lock, deadline, ready);
+        m_sleepers.fetch_sub(1);
+        return done;
+    }
+    auto notify() -> void {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (0 == m_sleepers.load(std::memory_order_relaxed)) return;
+        {
+            // a sleeper checking ready() holds the mutex, wait for it to sleep
+            std::lock_guard<std::mutex> lock(m_mutex);
+        }
+        m_cond.notify_all();
+    }
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    std::atomic<std::size_t> m_sleepers {0};
+
+    template < typename Ready >
+    auto spin( Ready &ready ) -> bool {
+        for ( std::size_t i(0); i < WAIT_SPIN_LIMIT; ++i ) {
+            if (ready()) return true;
+            cpuRelax();
+        }
+        return false;
+    }
+}; // class ParkWait
+
+#endif
@@ -23,4 +23,28 @@
 #define EMPTY                           (0)
 #define NULL_STRING                     ("null")
 
+#define CACHE_LINE_SIZE                 (64)
+
+#define NODE_POOL_MIN_CHUNK             (16)
+#define NODE_POOL_MAX_CHUNK             (4096)
+
+#define SKIP_INDEX_MAX_LEVEL            (16)
+
+#define BPLUS_TREE_NODE_BYTES           (256)
+#define BPLUS_TREE_MAX_HEIGHT           (64)
+
+#define HAZARD_POINTERS_PER_THREAD      (2)
+#define HAZARD_SCAN_THRESHOLD           (64)
+
+#define EPOCH_SCAN_THRESHOLD            (64)
+
+#define PARALLEL_MIN_CHUNK              (4096)
+#define PARALLEL_MAX_THREADS            (64)
+
+#define WAIT_SPIN_LIMIT                 (128)
+
+#define OCCUPANCY_HISTOGRAM_BUCKETS     (8)
+
+#define PERSISTENT_SYNC_INTERVAL        (1024)
+
 #endif
@@ -10,6 +10,20 @@
 #ifndef NODE_HPP_
 #define NODE_HPP_
 
+/***********************************************************
+ *                   std includes
+***********************************************************/
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+/***********************************************************
+ *               internal includes
+***********************************************************/
+#include "NodePool.hpp"
+#include "constants.hpp"
+
 template < typename T > 
 /** @struct Node
  *  @brief This structure is a node used by a doubly linked list
@@ -21,10 +35,19 @@ template < typename T >
  *  Pointer to the previous node
  */
 struct Node final {
-    Node<T>( const T _data, Node<T> *_next, Node<T> *_prev ) : 
+    Node<T>( const T &_data, Node<T> *_next, Node<T> *_prev ) : 
         data(_data),
         next(_next),
         prev(_prev) {}
+    Node<T>( T &&_data, Node<T> *_next, Node<T> *_prev ) : 
+        data(std::move(_data)),
+        next(_next),
+        prev(_prev) {}
+    template < typename... Args >
+    Node<T>( std::piecewise_construct_t, Node<T> *_next, Node<T> *_prev, Args&&... args ) : 
+        data(std::forward<Args>(args)...),
+        next(_next),
+        prev(_prev) {}
     
     T data {T(0)};
     Node<T> *next {nullptr}, *prev {nullptr};
@@ -39,17 +62,103 @@ template < typename T >
  *  Pointer to the left node
  *  @var TreeNode::right* git push --set-upstream origin BinaryTree
  *  Pointer to the right node
+ *  @var TreeNode::height
+ *  Height of the subtree rooted at the node
+ *  @var TreeNode::parent*
+ *  Pointer to the parent node, nullptr at the root
  */
 struct TreeNode final {
-    TreeNode ( const T _data, TreeNode<T> *_left, TreeNode<T> *_right ) :
+    TreeNode ( const T &_data, TreeNode<T> *_left, TreeNode<T> *_right ) :
         data(_data),
         left(_left),
         right(_right) {}
+    TreeNode ( T &&_data, TreeNode<T> *_left, TreeNode<T> *_right ) :
+        data(std::move(_data)),
+        left(_left),
+        right(_right) {}
+    template < typename... Args >
+    TreeNode ( std::piecewise_construct_t, TreeNode<T> *_left, TreeNode<T> *_right, Args&&... args ) :
+        data(std::forward<Args>(args)...),
+        left(_left),
+        right(_right) {}
     
     T data {T(0)};
+    std::int32_t height {1};
     TreeNode<T> *left {nullptr}, *right {nullptr};
+    TreeNode<T> *parent {nullptr};
 }; // struct TreeNode
 
+template < typename T >
+/** @brief : number of elements held by an unrolled node so that
+ *           the node fills one cache line (at least two elements)
+ *  @return : capacity of UnrolledNode<T>
+ */
+constexpr auto unrolledNodeCapacity() -> std::size_t {
+    // header is two links and an element count, items start aligned after it
+    const std::size_t header = (2 * sizeof(void*) + sizeof(std::uint32_t) + alignof(T) - 1)
+                               / alignof(T) * alignof(T);
+    const std::size_t capacity = (CACHE_LINE_SIZE > header) ?
+                                 (CACHE_LINE_SIZE - header) / sizeof(T) : 0;
+    return (capacity > 2) ? capacity : 2;
+}
+
+template < typename T >
+/** @struct UnrolledNode
+ *  @brief This structure is a node used by an unrolled linked list,
+ *         it stores up to CAPACITY elements in a single cache line
+ *  @var UnrolledNode::next* 
+ *  Pointer to the next node
+ *  @var UnrolledNode::prev* 
+ *  Pointer to the previous node
+ *  @var UnrolledNode::count
+ *  Number of elements constructed in items
+ *  @var UnrolledNode::items
+ *  Raw storage of the elements, only [0, count) is constructed
+ */
+struct alignas(CACHE_LINE_SIZE) UnrolledNode final {
+    static constexpr std::size_t CAPACITY = unrolledNodeCapacity<T>();
+
+    auto at( const std::size_t index ) -> T& {
+        return *reinterpret_cast<T*>(&items[index]);
+    }
+
+    UnrolledNode<T> *next {nullptr}, *prev {nullptr};
+    std::uint32_t count {0};
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type items[CAPACITY];
+}; // struct UnrolledNode
+
+template < typename T >
+constexpr std::size_t UnrolledNode<T>::CAPACITY;
+
+/** @struct DefaultHookTag
+ *  @brief Tag of the hook used when an object is linked on a single
+ *         intrusive list
+ */
+struct DefaultHookTag {};
+
+template < typename Tag = DefaultHookTag >
+/** @struct IntrusiveHook
+ *  @brief Links embedded in an object linked on an intrusive list. An
+ *         object derives from one hook per list it can be linked on,
+ *         each hook with its own Tag. Copying an object does not copy
+ *         its links.
+ *  @var IntrusiveHook::next*
+ *  Pointer to the next hook, nullptr when not linked
+ *  @var IntrusiveHook::prev*
+ *  Pointer to the previous hook, nullptr when not linked
+ */
+struct IntrusiveHook {
+    IntrusiveHook() = default;
+    IntrusiveHook( const IntrusiveHook & ) {}
+    auto operator=( const IntrusiveHook & ) -> IntrusiveHook& { return *this; }
+
+    auto linked() const -> bool {
+        return (nullptr != next);
+    }
+
+    IntrusiveHook<Tag> *next {nullptr}, *prev {nullptr};
+}; // struct IntrusiveHook
+
 template < typename T > 
 /** @brief : function to create a new node
  *  @param in  : data - data hold by a node
@@ -57,7 +166,7 @@ template < typename T >
  *               prev - pointer to previous node
  *  @return : new Node
  */
-auto createNewNode( const T data, 
+auto createNewNode( const T &data, 
                     Node<T> *next = nullptr, 
                     Node<T> *prev = nullptr ) -> Node<T>* {
     return new Node<T>(data, next, prev);
@@ -79,6 +188,97 @@ auto removeNodes( Node<T> *node ) -> void {
     }
 }
 
+template < typename T > 
+/** @brief : function to create a new node from a node pool
+ *  @param in  : pool - pool owning the node storage
+ *               data - data hold by a node
+ *               next - pointer to next node
+ *               prev - pointer to previous node
+ *  @return : new Node
+ */
+auto createNewNode( NodePool<Node<T>> &pool,
+                    const T &data, 
+                    Node<T> *next = nullptr, 
+                    Node<T> *prev = nullptr ) -> Node<T>* {
+    return pool.create(data, next, prev);
+}
+
+template < typename T, typename... Args > 
+/** @brief : function to construct a new node data in place in a node pool
+ *  @param in  : pool - pool owning the node storage
+ *               next - pointer to next node
+ *               prev - pointer to previous node
+ *               args - arguments forwarded to the constructor of T
+ *  @return : new Node
+ */
+auto emplaceNewNode( NodePool<Node<T>> &pool,
+                     Node<T> *next,
+                     Node<T> *prev,
+                     Args&&... args ) -> Node<T>* {
+    return pool.create(std::piecewise_construct, next, prev, std::forward<Args>(args)...);
+}
+
+template < typename T >
+/** @brief : function to give a single node back to its pool
+ *  @param in  : pool - pool owning the node storage
+ *               node - Pointer to node
+ *  @param out : none
+ */
+auto removeNode( NodePool<Node<T>> &pool, Node<T> *node ) -> void {
+    pool.destroy(node);
+}
+
+template < typename T >
+/** @brief : function to free all nodes of a pool at once. Nodes are
+ *           only visited when T has a non trivial destructor.
+ *  @param in  : pool - pool owning the node storage
+ *               node - Pointer to the first node of the chain
+ *  @param out : none
+ */
+auto removeNodes( NodePool<Node<T>> &pool, Node<T> *node ) -> void {
+    if (!std::is_trivially_destructible<Node<T>>::value) {
+        auto n = node;
+        while (nullptr != n) {
+            auto curr = n;
+            n = n->next;
+            curr->~Node<T>();
+        }
+    }
+    pool.clear();
+}
+
+template < typename T >
+/** @brief : function to destroy the elements of an unrolled node
+ *           and give it back to its pool
+ *  @param in  : pool - pool owning the node storage
+ *               node - Pointer to unrolled node
+ *  @param out : none
+ */
+auto removeUnrolledNode( NodePool<UnrolledNode<T>> &pool, UnrolledNode<T> *node ) -> void {
+    if (!std::is_trivially_destructible<T>::value) {
+        for ( std::size_t i(0); i < node->count; ++i )
+            node->at(i).~T();
+    }
+    pool.destroy(node);
+}
+
+template < typename T >
+/** @brief : function to free all unrolled nodes of a pool at once.
+ *           Elements are only visited when T has a non trivial destructor.
+ *  @param in  : pool - pool owning the node storage
+ *               node - Pointer to the first node of the chain
+ *  @param out : none
+ */
+auto removeUnrolledNodes( NodePool<UnrolledNode<T>> &pool, UnrolledNode<T> *node ) -> void {
+    if (!std::is_trivially_destructible<T>::value) {
+        for ( auto n = node; nullptr != n; n = n->next ) {
+            for ( std::size_t i(0); i < n->count; ++i )
+                n->at(i).~T();
+        }
+    }
+    pool.clear();
+}
+
 template < typename T >
 /** @brief : function to create a new tree node
  *  @param in  : data  - data hold by a tree node
@@ -86,7 +286,7 @@ template < typename T >
  *               right - pointer to right tree node
  *  @return : new TreeNode
  */
-auto createNewTreeNode( const T data,
+auto createNewTreeNode( const T &data,
                         TreeNode<T> *left  = nullptr,
                         TreeNode<T> *right = nullptr ) -> TreeNode<T>* {
     return new TreeNode<T>(data, left, right);
@@ -105,4 +305,57 @@ auto removeTreeNode( TreeNode<T> *node ) -> void {
     }
 }
 
+template < typename T >
+/** @brief : function to create a new tree node from a node pool
+ *  @param in  : pool  - pool owning the tree node storage
+ *               data  - data hold by a tree node
+ *               left  - pointer to left tree node
+ *               right - pointer to right tree node
+ *  @return : new TreeNode
+ */
+auto createNewTreeNode( NodePool<TreeNode<T>> &pool,
+                        const T &data,
+                        TreeNode<T> *left  = nullptr,
+                        TreeNode<T> *right = nullptr ) -> TreeNode<T>* {
+    return pool.create(data, left, right);
+}
+
+template < typename T, typename... Args >
+/** @brief : function to construct a new tree node data in place in a node pool
+ *  @param in  : pool  - pool owning the tree node storage
+ *               args  - arguments forwarded to the constructor of T
+ *  @return : new TreeNode without children
+ */
+auto emplaceNewTreeNode( NodePool<TreeNode<T>> &pool, Args&&... args ) -> TreeNode<T>* {
+    return pool.create(std::piecewise_construct, static_cast<TreeNode<T>*>(nullptr),
+                       static_cast<TreeNode<T>*>(nullptr), std::forward<Args>(args)...);
+}
+
+template < typename T >
+/** @brief : function to free all tree nodes of a pool at once. The tree
+ *           is only walked when T has a non trivial destructor, using
+ *           right rotations so that no recursion is needed.
+ *  @param in  : pool - pool owning the tree node storage
+ *               node - Pointer to the root tree node
+ *  @param out : none
+ */
+auto removeTreeNode( NodePool<TreeNode<T>> &pool, TreeNode<T> *node ) -> void {
+    if (!std::is_trivially_destructible<TreeNode<T>>::value) {
+        auto n = node;
+        while (nullptr != n) {
+            if (nullptr != n->left) {
+                auto left = n->left;
+                n->left = left->right;
+                left->right = n;
+                n = left;
+            } else {
+                auto right = n->right;
+                n->~TreeNode<T>();
+                n = right;
+            }
+        }
+    }
+    pool.clear();
+}
+
 #endif
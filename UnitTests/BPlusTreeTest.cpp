@@ -0,0 +1,139 @@
+/** @file BPlusTreeTest.cpp
+ *  @brief Test BPlusTree functionalities
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+/***********************************************************
+ *               Gtest includes
+***********************************************************/
+#include <gtest/gtest.h>
+
+/***********************************************************
+ *                   std includes
+***********************************************************/
+#include <cstdlib>
+#include <iterator>
+#include <set>
+#include <string>
+
+/***********************************************************
+ *               Internal includes
+***********************************************************/
+#include "../DataStructures/BPlusTree.hpp"
+
+/***********************************************************
+ *                   defines
+***********************************************************/
+#define BPLUS_TREE_KEYS      (1000000)
+
+/*******************************************************//**
+* @namespace : test
+*
+***********************************************************/
+namespace test {
+   /** @class BPlusTreeTest
+    *  @brief This class test BPlusTree functionalites
+    */
+    class BPlusTreeTest : public ::testing::Test {
+    public:
+        auto SetUp() -> void {
+        }
+
+        auto TearDown() -> void {
+        }
+
+    protected:
+        BPlusTree<int> m_tree;
+    }; // class BPlusTreeTest
+/***********************************************************/
+    TEST_F(BPlusTreeTest, test_sorted_insert)
+    /**
+     * @brief Test a million sorted keys, point lookups and a full scan
+     */
+    {
+        //Arrange
+        for ( auto i(0); i < BPLUS_TREE_KEYS; ++i )
+            m_tree.insert(2 * i);
+        //Expect
+        //Assert
+        ASSERT_EQ(BPLUS_TREE_KEYS, m_tree.size());
+        ASSERT_LE(m_tree.height(), 6);
+        ASSERT_TRUE(m_tree.contains(0));
+        ASSERT_TRUE(m_tree.contains(2 * (BPLUS_TREE_KEYS - 1)));
+        ASSERT_FALSE(m_tree.contains(777));
+        ASSERT_EQ(m_tree.end(), m_tree.find(-2));
+        auto expected(0);
+        for ( auto key : m_tree ) {
+            ASSERT_EQ(expected, key);
+            expected += 2;
+        }
+        ASSERT_EQ(2 * BPLUS_TREE_KEYS, expected);
+        m_tree.clear();
+        ASSERT_TRUE(m_tree.empty());
+        ASSERT_EQ(m_tree.begin(), m_tree.end());
+    }
+/***********************************************************/
+    TEST_F(BPlusTreeTest, test_bounds)
+    /**
+     * @brief Test lower_bound, upper_bound and range against a multiset
+     *        with random keys and duplicates
+     */
+    {
+        //Arrange
+        std::multiset<int> reference;
+        std::srand(23);
+        for ( auto i(0); i < 50000; ++i ) {
+            const auto key = std::rand() % 5000;
+            m_tree.insert(key);
+            reference.insert(key);
+        }
+        //Expect
+        EXPECT_TRUE(m_tree.range(10, 10).empty());
+        //Assert
+        ASSERT_TRUE(std::equal(reference.begin(), reference.end(), m_tree.begin()));
+        for ( auto i(-1); i <= 5000; ++i ) {
+            const auto lower = m_tree.lower_bound(i);
+            const auto upper = m_tree.upper_bound(i);
+            const auto expected = reference.lower_bound(i);
+            if (reference.end() == expected) {
+                ASSERT_EQ(m_tree.end(), lower);
+            } else {
+                ASSERT_EQ(*expected, *lower);
+            }
+            ASSERT_EQ(reference.count(i), static_cast<std::size_t>(std::distance(lower, upper)));
+        }
+        const auto range = m_tree.range(1000, 1100);
+        ASSERT_TRUE(std::equal(reference.lower_bound(1000), reference.lower_bound(1100), range.begin()));
+        ASSERT_EQ(std::distance(reference.lower_bound(1000), reference.lower_bound(1100)),
+                  std::distance(range.begin(), range.end()));
+    }
+/***********************************************************/
+    TEST_F(BPlusTreeTest, test_node_size)
+    /**
+     * @brief Test page sized nodes and elements with a non trivial
+     *        destructor
+     */
+    {
+        //Arrange
+        BPlusTree<long long, 4096> pages;
+        BPlusTree<std::string, 128> strings;
+        for ( auto i(0); i < 100000; ++i )
+            pages.insert(100000 - i);
+        for ( auto i(0); i < 1000; ++i )
+            strings.insert(std::to_string(i));
+        //Expect
+        //Assert
+        ASSERT_LE(pages.height(), 3);
+        ASSERT_EQ(1, *pages.begin());
+        ASSERT_EQ(50000, *pages.lower_bound(50000));
+        ASSERT_EQ(50001, *pages.upper_bound(50000));
+        ASSERT_TRUE(strings.contains("999"));
+        ASSERT_EQ("1", *strings.upper_bound("0"));
+        ASSERT_EQ(1000, strings.size());
+        strings.clear();
+        strings.insert("a");
+        ASSERT_EQ("a", *strings.begin());
+    }
+/***********************************************************/
+}; // namespace test
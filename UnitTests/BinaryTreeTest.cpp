@@ -9,11 +9,24 @@
 ***********************************************************/
 #include <gtest/gtest.h>
 
+/***********************************************************
+ *                   std includes
+***********************************************************/
+#include <cmath>
+#include <cstdlib>
+#include <set>
+#include <vector>
+
 /***********************************************************
  *               Internal includes
 ***********************************************************/
 #include "../DataStructures/BinaryTree.hpp"
 
+/***********************************************************
+ *                   defines
+***********************************************************/
+#define BALANCED_TREE_KEYS   (200000)
+
 /*******************************************************//**
 * @namespace : test
 * 
@@ -31,20 +44,220 @@ namespace test {
         BinaryTree<int> BT;
     }; // class BinaryTreeTest
 /***********************************************************/
-    TEST_F(BinaryTreeTest, test_insert) {
-
+    TEST_F(BinaryTreeTest, test_insert)
+    /**
+     * @brief Test insert, emplace and duplicates of BinaryTree class.
+     */
+    {
+        //Arrange
+        BT.insert(5);
+        BT.insert(3);
+        BT.insert(8);
+        BT.insert(5);
+        //Expect
+        //Assert
+        ASSERT_EQ(7, BT.emplace(7));
+        ASSERT_NE(nullptr, BT.find(3));
+        ASSERT_NE(nullptr, BT.find(7));
+        ASSERT_TRUE(BT.erase(5));
+        ASSERT_NE(nullptr, BT.find(5));
     }
 /***********************************************************/
-    TEST_F(BinaryTreeTest, test_find) {
-
+    TEST_F(BinaryTreeTest, test_find)
+    /**
+     * @brief Test find function of BinaryTree class.
+     */
+    {
+        //Arrange
+        for ( auto i : {50, 20, 70, 10, 30, 60, 80} )
+            BT.insert(i);
+        //Expect
+        //Assert
+        ASSERT_EQ(30, BT.find(30)->data);
+        ASSERT_EQ(80, BT.find(80)->data);
+        ASSERT_EQ(nullptr, BT.find(35));
     }
 /***********************************************************/ 
-    TEST_F(BinaryTreeTest, test_clear) {
-
+    TEST_F(BinaryTreeTest, test_clear)
+    /**
+     * @brief Test clear function of BinaryTree class.
+     */
+    {
+        //Arrange
+        for ( auto i(0); i < 100; ++i )
+            BT.insert(i);
+        BT.clear();
+        //Expect
+        //Assert
+        ASSERT_EQ(0, BT.lenght());
+        ASSERT_EQ(nullptr, BT.find(10));
+        BT.insert(1);
+        ASSERT_EQ(1, BT.lenght());
     }
 /***********************************************************/
-    TEST_F(BinaryTreeTest, test_length) {
-
+    TEST_F(BinaryTreeTest, test_length)
+    /**
+     * @brief Test lenght of an unbalanced tree fed sorted keys.
+     */
+    {
+        //Arrange
+        for ( auto i(0); i < 1000; ++i )
+            BT.insert(i);
+        //Expect
+        //Assert
+        ASSERT_EQ(1000, BT.lenght());
+        ASSERT_TRUE(BT.erase(0));
+        ASSERT_EQ(999, BT.lenght());
+    }
+/***********************************************************/
+    TEST_F(BinaryTreeTest, test_erase)
+    /**
+     * @brief Test erase of leaves, nodes with one child and nodes with
+     *        two children, in both modes.
+     */
+    {
+        //Arrange
+        BinaryTree<int, BALANCE_AVL> avl;
+        for ( auto i : {50, 20, 70, 10, 30, 60, 80, 25, 35} ) {
+            BT.insert(i);
+            avl.insert(i);
+        }
+        //Expect
+        //Assert
+        for ( auto i : {10, 30, 20, 50, 99} ) {
+            ASSERT_EQ(99 != i, BT.erase(i));
+            ASSERT_EQ(99 != i, avl.erase(i));
+            ASSERT_EQ(nullptr, BT.find(i));
+            ASSERT_EQ(nullptr, avl.find(i));
+        }
+        for ( auto i : {25, 35, 60, 70, 80} ) {
+            ASSERT_NE(nullptr, BT.find(i));
+            ASSERT_NE(nullptr, avl.find(i));
+        }
+        ASSERT_EQ(3, avl.lenght());
+    }
+/***********************************************************/
+    TEST_F(BinaryTreeTest, test_balanced)
+    /**
+     * @brief Test an AVL tree keeps a logarithmic height with sorted
+     *        and random inserts and erases.
+     */
+    {
+        //Arrange
+        BinaryTree<int, BALANCE_AVL> avl;
+        std::multiset<int> reference;
+        for ( auto i(0); i < BALANCED_TREE_KEYS; ++i )
+            avl.insert(i);
+        const auto limit = 1.45 * std::log2(BALANCED_TREE_KEYS + 2.0);
+        //Expect
+        //Assert
+        ASSERT_LE(avl.lenght(), limit);
+        ASSERT_EQ(BALANCED_TREE_KEYS - 1, avl.find(BALANCED_TREE_KEYS - 1)->data);
+        for ( auto i(0); i < BALANCED_TREE_KEYS; i += 2 )
+            ASSERT_TRUE(avl.erase(i));
+        ASSERT_LE(avl.lenght(), limit);
+        ASSERT_EQ(nullptr, avl.find(BALANCED_TREE_KEYS / 2));
+        avl.clear();
+        std::srand(21);
+        for ( auto i(0); i < 20000; ++i ) {
+            const auto key = std::rand() % 1000;
+            if (0 == std::rand() % 3) {
+                const auto itr = reference.find(key);
+                ASSERT_EQ(reference.end() != itr, avl.erase(key));
+                if (reference.end() != itr) reference.erase(itr);
+            } else {
+                avl.insert(key);
+                reference.insert(key);
+            }
+        }
+        for ( auto i(0); i < 1000; ++i )
+            ASSERT_EQ(0 != reference.count(i), nullptr != avl.find(i));
+        ASSERT_LE(avl.lenght(), 1.45 * std::log2(reference.size() + 2.0));
+    }
+    TEST_F(BinaryTreeTest, test_iterators)
+    /**
+     * @brief Test in-order, pre-order and post-order iterators, size and
+     *        erase through an iterator.
+     */
+    {
+        //Arrange
+        for ( auto i : {50, 20, 70, 10, 30, 60, 80, 25} )
+            BT.insert(i);
+        std::vector<int> inOrder, preOrder, postOrder, backward;
+        for ( auto data : BT )
+            inOrder.push_back(data);
+        for ( auto data : BT.preOrder() )
+            preOrder.push_back(data);
+        for ( auto data : BT.postOrder() )
+            postOrder.push_back(data);
+        for ( auto itr = BT.end(); itr != BT.begin(); )
+            backward.push_back(*--itr);
+        //Expect
+        EXPECT_EQ(std::vector<int>({10, 20, 25, 30, 50, 60, 70, 80}), inOrder);
+        EXPECT_EQ(std::vector<int>({50, 20, 10, 30, 25, 70, 60, 80}), preOrder);
+        EXPECT_EQ(std::vector<int>({10, 25, 30, 20, 60, 80, 70, 50}), postOrder);
+        EXPECT_EQ(std::vector<int>({80, 70, 60, 50, 30, 25, 20, 10}), backward);
+        //Assert
+        ASSERT_EQ(8, BT.size());
+        auto itr = BT.erase(BT.lower_bound(20));
+        ASSERT_EQ(25, *itr);
+        itr = BT.erase(++itr);
+        ASSERT_EQ(50, *itr);
+        ASSERT_EQ(6, BT.size());
+        BinaryTree<int, BALANCE_AVL> avl;
+        for ( auto i(0); i < 1000; ++i )
+            avl.insert(i);
+        for ( auto erased = avl.begin(); avl.end() != erased; )
+            erased = (0 == *erased % 3) ? avl.erase(erased) : std::next(erased);
+        auto expected(1);
+        for ( auto data : avl ) {
+            ASSERT_EQ(expected, data);
+            expected += (1 == expected % 3) ? 1 : 2;
+        }
+        ASSERT_EQ(666, avl.size());
+        BT.clear();
+        ASSERT_TRUE(BT.empty());
+        ASSERT_TRUE(BT.begin() == BT.end());
+        ASSERT_TRUE(BT.preOrder().begin() == BT.preOrder().end());
+        ASSERT_TRUE(BT.postOrder().begin() == BT.postOrder().end());
+    }
+/***********************************************************/
+    TEST_F(BinaryTreeTest, test_bounds)
+    /**
+     * @brief Test lower_bound, upper_bound, min and max against a multiset.
+     */
+    {
+        //Arrange
+        BinaryTree<int, BALANCE_AVL> avl;
+        std::multiset<int> reference;
+        std::srand(24);
+        //Expect
+        EXPECT_THROW(avl.min(), Exception);
+        EXPECT_THROW(avl.max(), Exception);
+        //Assert
+        for ( auto i(0); i < 5000; ++i ) {
+            const auto key = std::rand() % 2000;
+            avl.insert(key);
+            reference.insert(key);
+        }
+        ASSERT_EQ(*reference.begin(), avl.min());
+        ASSERT_EQ(*reference.rbegin(), avl.max());
+        for ( auto key(-1); key <= 2000; ++key ) {
+            const auto lower = reference.lower_bound(key);
+            const auto upper = reference.upper_bound(key);
+            const auto itr = avl.lower_bound(key);
+            ASSERT_EQ(reference.end() == lower, avl.end() == itr);
+            if (reference.end() != lower) {
+                ASSERT_EQ(*lower, *itr);
+            }
+            ASSERT_EQ(reference.end() == upper, avl.end() == avl.upper_bound(key));
+            if (reference.end() != upper) {
+                ASSERT_EQ(*upper, *avl.upper_bound(key));
+            }
+            ASSERT_EQ(static_cast<std::ptrdiff_t>(reference.count(key)),
+                      std::distance(itr, avl.upper_bound(key)));
+        }
+        ASSERT_EQ(reference.size(), avl.size());
     }
 /***********************************************************/    
 }; // namespace test
@@ -9,6 +9,12 @@
 ***********************************************************/
 #include <gtest/gtest.h>
 
+/***********************************************************
+ *                   std includes
+***********************************************************/
+#include <string>
+#include <thread>
+
 /***********************************************************
  *               Internal includes
 ***********************************************************/
@@ -94,5 +100,248 @@ namespace test {
         CB.removeAll();
         ASSERT_TRUE(CB.empty());
     }
+/***********************************************************/
+    TEST_F(CircularBufferTest, test_emplace)
+    /**
+     * @brief Test emplace and rvalue put of CircularBuffer
+     *        class.
+     */
+    {
+        //Arrange
+        CircularBuffer<std::string, BUFFER_SIZE> buffer;
+        std::string data(100, 'b');
+        buffer.put(std::move(data));
+        buffer.emplace(3, 'c');
+        //Expect
+        //Assert
+        ASSERT_TRUE(data.empty());
+        ASSERT_EQ(std::string(100, 'b'), buffer[0]);
+        ASSERT_EQ("ccc", buffer[1]);
+    }
+/***********************************************************/
+    TEST_F(CircularBufferTest, test_put_oldest)
+    /**
+     * @brief Test putting the oldest element of a full buffer,
+     *        which the put overwrites, on both storages.
+     */
+    {
+        //Arrange
+        CircularBuffer<std::string, 3> list;
+        CircularBuffer<std::string, 3, STORAGE_ARRAY> array;
+        for ( auto c : {'a', 'b', 'c'} ) {
+            list.put(std::string(100, c));
+            array.put(std::string(100, c));
+        }
+        list.put(list[0]);
+        array.put(array[0]);
+        //Expect
+        EXPECT_EQ(3, list.count());
+        EXPECT_EQ(3, array.count());
+        //Assert
+        ASSERT_EQ(std::string(100, 'b'), list[0]);
+        ASSERT_EQ(std::string(100, 'a'), list[2]);
+        ASSERT_EQ(std::string(100, 'b'), array[0]);
+        ASSERT_EQ(std::string(100, 'a'), array[2]);
+    }
+/***********************************************************/
+    TEST_F(CircularBufferTest, test_array_put)
+    /**
+     * @brief Test put wrapping around array storage of power of
+     *        two and other sizes
+     */
+    {
+        //Arrange
+        CircularBuffer<int, 4, STORAGE_ARRAY> pow2;
+        CircularBuffer<int, BUFFER_SIZE, STORAGE_ARRAY> odd;
+        for ( auto i(0); i < 11; ++i ) {
+            pow2.put(i);
+            odd.put(i);
+        }
+        //Expect
+        EXPECT_THROW(odd[BUFFER_SIZE], Exception);
+        //Assert
+        ASSERT_EQ(4, pow2.count());
+        ASSERT_EQ(BUFFER_SIZE, odd.count());
+        for ( auto i(0); i < 4; ++i )
+            ASSERT_EQ(7 + i, pow2[i]);
+        for ( auto i(0); i < BUFFER_SIZE; ++i )
+            ASSERT_EQ(6 + i, odd[i]);
+    }
+/***********************************************************/
+    TEST_F(CircularBufferTest, test_array_remove)
+    /**
+     * @brief Test remove, removeAll and emplace with array storage
+     */
+    {
+        //Arrange
+        CircularBuffer<std::string, 3, STORAGE_ARRAY> buffer;
+        buffer.put("a");
+        buffer.put("b");
+        buffer.put("c");
+        buffer.put("d");
+        buffer.remove("c");
+        buffer.emplace(2, 'e');
+        //Expect
+        //Assert
+        ASSERT_EQ(3, buffer.count());
+        ASSERT_EQ("b", buffer[0]);
+        ASSERT_EQ("d", buffer[1]);
+        ASSERT_EQ("ee", buffer[2]);
+        buffer.removeAll();
+        ASSERT_TRUE(buffer.empty());
+        buffer.put("f");
+        ASSERT_EQ("f", buffer[0]);
+    }
+/***********************************************************/
+    TEST_F(CircularBufferTest, test_put_get_block)
+    /**
+     * @brief Test block put, get and peek across the wrap point with
+     *        both storages
+     */
+    {
+        //Arrange
+        CircularBuffer<int, 8, STORAGE_ARRAY> array;
+        int input[20], output[20] = {};
+        for ( auto i(0); i < 20; ++i )
+            input[i] = i;
+        array.put(input, 6);
+        CB.put(input, 4);
+        //Expect
+        //Assert
+        ASSERT_EQ(4, array.get(output, 4));
+        ASSERT_EQ(3, output[3]);
+        array.put(input + 6, 5);
+        ASSERT_EQ(7, array.count());
+        ASSERT_EQ(7, array.peek(output, 20));
+        for ( auto i(0); i < 7; ++i )
+            ASSERT_EQ(4 + i, output[i]);
+        array.put(input, 3);
+        ASSERT_EQ(6, array[0]);
+        array.put(input, 20);
+        ASSERT_EQ(8, array.get(output, 10));
+        ASSERT_EQ(12, output[0]);
+        ASSERT_EQ(19, output[7]);
+        ASSERT_TRUE(array.empty());
+        CB.put(input + 4, 3);
+        ASSERT_EQ(BUFFER_SIZE, CB.get(output, 20));
+        for ( auto i(0); i < BUFFER_SIZE; ++i )
+            ASSERT_EQ(2 + i, output[i]);
+        ASSERT_TRUE(CB.empty());
+    }
+/***********************************************************/
+    TEST_F(CircularBufferTest, test_get_non_trivial)
+    /**
+     * @brief Test block get moves non trivially copyable elements
+     */
+    {
+        //Arrange
+        CircularBuffer<std::string, 3, STORAGE_ARRAY> buffer;
+        const std::string input[] = {"a", "b", "c", "d"};
+        std::string output[3];
+        buffer.put(input, 4);
+        //Expect
+        //Assert
+        ASSERT_EQ(1, buffer.peek(output, 1));
+        ASSERT_EQ("b", output[0]);
+        ASSERT_EQ(3, buffer.get(output, 3));
+        ASSERT_EQ("d", output[2]);
+        ASSERT_TRUE(buffer.empty());
+    }
+/***********************************************************/
+    TEST_F(CircularBufferTest, test_overflow_reject)
+    /**
+     * @brief Test a full buffer rejecting new elements keeps the
+     *        oldest ones
+     */
+    {
+        //Arrange
+        CircularBuffer<int, 4, STORAGE_ARRAY, OVERFLOW_REJECT_NEWEST> buffer;
+        const int input[] = {10, 11, 12, 13, 14};
+        ASSERT_TRUE(buffer.put(1));
+        ASSERT_TRUE(buffer.emplace(2));
+        //Expect
+        //Assert
+        ASSERT_EQ(2, buffer.put(input, 5));
+        ASSERT_FALSE(buffer.put(3));
+        ASSERT_EQ(0, buffer.put(input, 1));
+        ASSERT_EQ(4, buffer.count());
+        ASSERT_EQ(1, buffer[0]);
+        ASSERT_EQ(11, buffer[3]);
+        const auto stats = buffer.stats();
+        ASSERT_EQ(9, stats.puts);
+        ASSERT_EQ(5, stats.rejected);
+        ASSERT_EQ(0, stats.overwritten);
+        ASSERT_EQ(OVERFLOW_REJECT_NEWEST, buffer.overflow());
+        // only a blocking buffer carries a mutex and a condition variable
+        ASSERT_LT(sizeof(buffer), (sizeof(CircularBuffer<int, 4, STORAGE_ARRAY, OVERFLOW_BLOCK>)));
+    }
+/***********************************************************/
+    TEST_F(CircularBufferTest, test_overflow_block)
+    /**
+     * @brief Test a full buffer blocks producers until a consumer
+     *        makes room, no element is lost
+     */
+    {
+        //Arrange
+        CircularBuffer<int, 3, STORAGE_ARRAY, OVERFLOW_BLOCK> buffer;
+        int input[20], output[20] = {};
+        for ( auto i(0); i < 20; ++i )
+            input[i] = i;
+        std::thread producer([&] {
+            buffer.put(input, 10);
+            for ( auto i(10); i < 20; ++i )
+                buffer.put(input[i]);
+        });
+        std::size_t received(0);
+        while (received < 20) {
+            received += buffer.get(output + received, 20 - received);
+            std::this_thread::yield();
+        }
+        producer.join();
+        //Expect
+        //Assert
+        for ( auto i(0); i < 20; ++i )
+            ASSERT_EQ(i, output[i]);
+        const auto stats = buffer.stats();
+        ASSERT_EQ(20, stats.puts);
+        ASSERT_EQ(0, stats.rejected);
+        ASSERT_EQ(0, stats.overwritten);
+        ASSERT_TRUE(buffer.empty());
+    }
+/***********************************************************/
+    TEST_F(CircularBufferTest, test_stats)
+    /**
+     * @brief Test overwrite counters, high-water mark and occupancy
+     *        histogram
+     */
+    {
+        //Arrange
+        CircularBuffer<int, 16, STORAGE_ARRAY> buffer;
+        int input[20] = {}, output[20];
+        for ( auto i(0); i < 6; ++i )
+            CB.put(i);
+        buffer.put(input, 3);
+        buffer.get(output, 3);
+        buffer.put(input, 20);
+        auto stats = CB.stats();
+        //Expect
+        //Assert
+        ASSERT_EQ(OVERFLOW_OVERWRITE_OLDEST, CB.overflow());
+        ASSERT_EQ(6, stats.puts);
+        ASSERT_EQ(1, stats.overwritten);
+        ASSERT_EQ(BUFFER_SIZE, stats.highWater);
+        ASSERT_EQ(2, stats.occupancy[OCCUPANCY_HISTOGRAM_BUCKETS - 1]);
+        stats = buffer.stats();
+        ASSERT_EQ(23, stats.puts);
+        ASSERT_EQ(4, stats.overwritten);
+        ASSERT_EQ(16, stats.highWater);
+        ASSERT_EQ(1, stats.occupancy[1]);
+        ASSERT_EQ(1, stats.occupancy[OCCUPANCY_HISTOGRAM_BUCKETS - 1]);
+        buffer.resetStats();
+        stats = buffer.stats();
+        ASSERT_EQ(0, stats.puts);
+        ASSERT_EQ(0, stats.highWater);
+        ASSERT_EQ(0, stats.occupancy[1]);
+    }
 /***********************************************************/
 }; // namespace test
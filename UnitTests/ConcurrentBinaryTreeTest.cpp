@@ -0,0 +1,225 @@
+/** @file ConcurrentBinaryTreeTest.cpp
+ *  @brief Test ConcurrentBinaryTree functionalities
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+/***********************************************************
+ *               Gtest includes
+***********************************************************/
+#include <gtest/gtest.h>
+
+/***********************************************************
+ *                   std includes
+***********************************************************/
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+/***********************************************************
+ *               Internal includes
+***********************************************************/
+#include "../DataStructures/ConcurrentBinaryTree.hpp"
+
+/***********************************************************
+ *                   defines
+***********************************************************/
+#define CONCURRENT_TREE_READERS     (4)
+#define CONCURRENT_TREE_KEYS        (4096)
+#define CONCURRENT_TREE_READS       (100000)
+
+/*******************************************************//**
+* @namespace : test
+*
+***********************************************************/
+namespace test {
+   /** @struct Fragile
+    *  @brief Element whose copy constructor throws once a budget of
+    *         copies is spent, a negative budget never throws
+    */
+    struct Fragile {
+        static int budget;
+        int value;
+
+        Fragile( const int _value = 0 ) : value(_value) {}
+        Fragile( const Fragile &other ) : value(other.value) {
+            if (0 == budget) throw std::runtime_error("copy budget spent");
+            if (budget > 0) budget--;
+        }
+        auto operator=( const Fragile & ) -> Fragile& = default;
+        auto operator==( const Fragile &other ) const -> bool { return value == other.value; }
+        auto operator>( const Fragile &other ) const -> bool { return value > other.value; }
+    }; // struct Fragile
+    int Fragile::budget = -1;
+
+   /** @class ConcurrentBinaryTreeTest
+    *  @brief This class test ConcurrentBinaryTree functionalites
+    */
+    class ConcurrentBinaryTreeTest : public ::testing::Test {
+    public:
+        auto SetUp() -> void {
+        }
+
+        auto TearDown() -> void {
+        }
+
+    protected:
+        ConcurrentBinaryTree<int> m_tree;
+    }; // class ConcurrentBinaryTreeTest
+/***********************************************************/
+    TEST_F(ConcurrentBinaryTreeTest, test_insert_erase)
+    /**
+     * @brief Test inserts, erases and lookups against a multiset and the
+     *        height bound of the AVL tree
+     */
+    {
+        //Arrange
+        std::multiset<int> reference;
+        std::srand(25);
+        for ( auto i(0); i < 20000; ++i ) {
+            const auto key = std::rand() % 1000;
+            if (0 == std::rand() % 3) {
+                const auto itr = reference.find(key);
+                ASSERT_EQ(reference.end() != itr, m_tree.erase(key));
+                if (reference.end() != itr) reference.erase(itr);
+            } else {
+                m_tree.insert(key);
+                reference.insert(key);
+            }
+        }
+        //Expect
+        EXPECT_EQ(reference.size(), m_tree.size());
+        EXPECT_LE(m_tree.lenght(), 1.45 * std::log2(reference.size() + 2.0));
+        //Assert
+        auto output(-1);
+        for ( auto i(0); i < 1000; ++i ) {
+            ASSERT_EQ(0 != reference.count(i), m_tree.contains(i));
+            ASSERT_EQ(0 != reference.count(i), m_tree.find(i, output));
+            const auto lower = reference.lower_bound(i);
+            ASSERT_EQ(reference.end() != lower, m_tree.lowerBound(i, output));
+            if (reference.end() != lower) {
+                ASSERT_EQ(*lower, output);
+            }
+        }
+        m_tree.clear();
+        ASSERT_TRUE(m_tree.empty());
+        ASSERT_FALSE(m_tree.contains(*reference.begin()));
+        ASSERT_EQ(0, m_tree.lenght());
+    }
+/***********************************************************/
+    TEST_F(ConcurrentBinaryTreeTest, test_freeze)
+    /**
+     * @brief Test the snapshot holds the elements in order
+     */
+    {
+        //Arrange
+        for ( auto i : {50, 20, 70, 10, 30, 60, 80, 30} )
+            m_tree.insert(i);
+        const auto frozen = m_tree.freeze();
+        m_tree.erase(50);
+        //Expect
+        //Assert
+        ASSERT_EQ(8, frozen.size());
+        ASSERT_TRUE(frozen.contains(50));
+        ASSERT_EQ(60, *frozen.lowerBound(55));
+        ASSERT_FALSE(m_tree.contains(50));
+    }
+/***********************************************************/
+    TEST_F(ConcurrentBinaryTreeTest, test_concurrent)
+    /**
+     * @brief Test readers running beside a writer in a 99% read mix: the
+     *        even keys are never erased and must always be found, the odd
+     *        keys come and go
+     */
+    {
+        //Arrange
+        for ( auto i(0); i < CONCURRENT_TREE_KEYS; i += 2 )
+            m_tree.insert(i);
+        std::atomic<bool> done {false};
+        std::atomic<int> missed {0};
+        std::atomic<long long> found {0};
+        std::vector<std::thread> threads;
+        for ( auto t(0); t < CONCURRENT_TREE_READERS; ++t ) {
+            threads.emplace_back([this, t, &done, &missed, &found]() {
+                auto key(t), output(-1);
+                auto hits(0LL);
+                for ( auto i(0); i < CONCURRENT_TREE_READS || !done.load(); ++i ) {
+                    key = (key * 7 + 13) % CONCURRENT_TREE_KEYS;
+                    const auto hit = m_tree.find(key, output);
+                    if (hit && output != key) missed++;
+                    if (0 == key % 2 && !hit) missed++;
+                    hits += hit;
+                    if (0 == i % 1024) std::this_thread::yield();
+                }
+                found += hits;
+            });
+        }
+        threads.emplace_back([this, &done]() {
+            // every odd key is inserted then erased
+            for ( auto i(0); i < CONCURRENT_TREE_KEYS; ++i ) {
+                const auto key = 2 * (i % (CONCURRENT_TREE_KEYS / 2)) + 1;
+                if (!m_tree.erase(key)) m_tree.insert(key);
+                if (0 == i % 16) std::this_thread::yield();
+            }
+            done.store(true);
+        });
+        for ( auto &thread : threads )
+            thread.join();
+        //Expect
+        EXPECT_LT(0, found.load());
+        //Assert
+        ASSERT_EQ(0, missed.load());
+        for ( auto i(0); i < CONCURRENT_TREE_KEYS; i += 2 )
+            ASSERT_TRUE(m_tree.contains(i));
+        ASSERT_FALSE(m_tree.contains(1));
+        ASSERT_EQ(CONCURRENT_TREE_KEYS / 2, m_tree.size());
+    }
+/***********************************************************/
+    TEST_F(ConcurrentBinaryTreeTest, test_throwing_copy)
+    /**
+     * @brief Test a write whose element copy throws leaves the published
+     *        tree untouched and later writes work
+     */
+    {
+        //Arrange
+        ConcurrentBinaryTree<Fragile> tree;
+        std::set<int> reference;
+        for ( auto i(0); i < 64; ++i ) {
+            tree.insert(Fragile(2 * i));
+            reference.insert(2 * i);
+        }
+        auto thrown(0);
+        for ( auto budget(0); budget < 24; ++budget ) {
+            const auto key = (budget % 2) ? 2 * budget : 2 * budget + 1;
+            Fragile::budget = budget;
+            try {
+                if (budget % 2) {
+                    tree.erase(Fragile(key));
+                    reference.erase(key);
+                } else {
+                    tree.insert(Fragile(key));
+                    reference.insert(key);
+                }
+            } catch (const std::runtime_error &) {
+                thrown++;
+            }
+            Fragile::budget = -1;
+        }
+        //Expect
+        EXPECT_LT(0, thrown);
+        EXPECT_GT(24, thrown);
+        //Assert
+        ASSERT_EQ(reference.size(), tree.size());
+        for ( auto i(0); i < 128; ++i )
+            ASSERT_EQ(0 != reference.count(i), tree.contains(Fragile(i)));
+        tree.insert(Fragile(1000));
+        ASSERT_TRUE(tree.erase(Fragile(0)));
+        ASSERT_TRUE(tree.contains(Fragile(1000)));
+        ASSERT_FALSE(tree.contains(Fragile(0)));
+    }
+/***********************************************************/
+}; // namespace test
@@ -0,0 +1,174 @@
+/** @file DynamicCircularBufferTest.cpp
+ *  @brief Test DynamicCircularBuffer functionalities
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+/***********************************************************
+ *               Gtest includes
+***********************************************************/
+#include <gtest/gtest.h>
+
+/***********************************************************
+ *                   std includes
+***********************************************************/
+#include <stdexcept>
+#include <string>
+
+/***********************************************************
+ *               Internal includes
+***********************************************************/
+#include "../DataStructures/DynamicCircularBuffer.hpp"
+
+/***********************************************************
+ *                   defines
+***********************************************************/
+#define DYNAMIC_BUFFER_SIZE   (5)
+
+/*******************************************************//**
+* @namespace : test
+*
+***********************************************************/
+namespace test {
+    /** @struct Moved
+     *  @brief Value counting how many times it was moved
+     */
+    struct Moved {
+        int value {0};
+        int moves {0};
+        Moved() = default;
+        Moved( const int input ) : value(input) {}
+        Moved( Moved &&other ) noexcept : value(other.value), moves(other.moves + 1) {}
+        auto operator=( Moved &&other ) noexcept -> Moved& {
+            value = other.value;
+            moves = other.moves + 1;
+            return *this;
+        }
+    }; // struct Moved
+
+   /** @class DynamicCircularBufferTest
+    *  @brief This class test DynamicCircularBuffer functionalites
+    */
+    class DynamicCircularBufferTest : public ::testing::Test {
+    public:
+        DynamicCircularBufferTest() : m_buffer(DYNAMIC_BUFFER_SIZE) {}
+
+        auto SetUp() -> void {
+        }
+
+        auto TearDown() -> void {
+        }
+
+    protected:
+        DynamicCircularBuffer<int> m_buffer;
+    }; // class DynamicCircularBufferTest
+/***********************************************************/
+    TEST_F(DynamicCircularBufferTest, test_put)
+    /**
+     * @brief Test put overwrites the oldest element and block put, get
+     *        and peek across the wrap point
+     */
+    {
+        //Arrange
+        int input[8] = {10, 11, 12, 13, 14, 15, 16, 17}, output[8] = {};
+        for ( auto i(0); i < 7; ++i )
+            m_buffer.put(i);
+        //Expect
+        EXPECT_THROW(DynamicCircularBuffer<int>(0), Exception);
+        EXPECT_THROW(m_buffer[DYNAMIC_BUFFER_SIZE], Exception);
+        //Assert
+        ASSERT_EQ(DYNAMIC_BUFFER_SIZE, m_buffer.count());
+        ASSERT_EQ(2, m_buffer[0]);
+        ASSERT_EQ(6, m_buffer[4]);
+        m_buffer.put(input, 3);
+        ASSERT_EQ(5, m_buffer[0]);
+        ASSERT_EQ(2, m_buffer.peek(output, 2));
+        ASSERT_EQ(6, output[1]);
+        m_buffer.put(input, 8);
+        ASSERT_EQ(DYNAMIC_BUFFER_SIZE, m_buffer.get(output, 8));
+        ASSERT_EQ(13, output[0]);
+        ASSERT_EQ(17, output[4]);
+        ASSERT_TRUE(m_buffer.empty());
+    }
+/***********************************************************/
+    TEST_F(DynamicCircularBufferTest, test_resize)
+    /**
+     * @brief Test reserve and resize keep the newest elements in order
+     *        and move each of them once
+     */
+    {
+        //Arrange
+        DynamicCircularBuffer<Moved> buffer(4);
+        for ( auto i(0); i < 6; ++i )
+            buffer.emplace(i);
+        //Expect
+        EXPECT_THROW(buffer.resize(0), Exception);
+        //Assert
+        buffer.reserve(2);
+        ASSERT_EQ(4, buffer.capacity());
+        buffer.reserve(8);
+        ASSERT_EQ(8, buffer.capacity());
+        ASSERT_EQ(4, buffer.count());
+        // 4 and 5 overwrote an element, which moved them in once
+        for ( auto i(0); i < 4; ++i ) {
+            ASSERT_EQ(2 + i, buffer[i].value);
+            ASSERT_EQ((i < 2) ? 1 : 2, buffer[i].moves);
+        }
+        buffer.emplace(6);
+        buffer.resize(3);
+        ASSERT_EQ(3, buffer.capacity());
+        ASSERT_EQ(3, buffer.count());
+        for ( auto i(0); i < 3; ++i )
+            ASSERT_EQ(4 + i, buffer[i].value);
+        ASSERT_EQ(3, buffer[0].moves);
+        ASSERT_EQ(1, buffer[2].moves);
+        buffer.emplace(7);
+        ASSERT_EQ(5, buffer[0].value);
+    }
+/***********************************************************/
+    TEST_F(DynamicCircularBufferTest, test_remove)
+    /**
+     * @brief Test remove and removeAll of non trivial elements
+     */
+    {
+        //Arrange
+        DynamicCircularBuffer<std::string> buffer(3);
+        buffer.put("a");
+        buffer.put("b");
+        buffer.put("c");
+        buffer.put("d");
+        buffer.remove("c");
+        //Expect
+        //Assert
+        ASSERT_EQ(2, buffer.count());
+        ASSERT_EQ("b", buffer[0]);
+        ASSERT_EQ("d", buffer[1]);
+        buffer.removeAll();
+        ASSERT_TRUE(buffer.empty());
+        buffer.emplace(2, 'e');
+        ASSERT_EQ("ee", buffer[0]);
+    }
+/***********************************************************/
+    TEST_F(DynamicCircularBufferTest, test_put_oldest)
+    /**
+     * @brief Test putting the oldest element of a full buffer and a
+     *        throwing constructor, which both keep the oldest element
+     *        until the new one is built
+     */
+    {
+        //Arrange
+        DynamicCircularBuffer<std::string> buffer(3);
+        for ( auto c : {'a', 'b', 'c'} )
+            buffer.put(std::string(100, c));
+        //Expect
+        EXPECT_THROW(buffer.emplace(std::string::npos, 'd'), std::length_error);
+        //Assert
+        ASSERT_EQ(3, buffer.count());
+        ASSERT_EQ(std::string(100, 'a'), buffer[0]);
+        buffer.put(buffer[0]);
+        ASSERT_EQ(3, buffer.count());
+        ASSERT_EQ(std::string(100, 'b'), buffer[0]);
+        ASSERT_EQ(std::string(100, 'a'), buffer[2]);
+    }
+/***********************************************************/
+}; // namespace test
@@ -0,0 +1,100 @@
+/** @file FrozenBinaryTreeTest.cpp
+ *  @brief Test FrozenBinaryTree functionalities
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+/***********************************************************
+ *               Gtest includes
+***********************************************************/
+#include <gtest/gtest.h>
+
+/***********************************************************
+ *                   std includes
+***********************************************************/
+#include <cstdlib>
+#include <set>
+#include <vector>
+
+/***********************************************************
+ *               Internal includes
+***********************************************************/
+#include "../DataStructures/BinaryTree.hpp"
+
+/*******************************************************//**
+* @namespace : test
+*
+***********************************************************/
+namespace test {
+   /** @class FrozenBinaryTreeTest
+    *  @brief This class test FrozenBinaryTree functionalites
+    */
+    class FrozenBinaryTreeTest : public ::testing::Test {
+    public:
+        auto SetUp() -> void {
+        }
+
+        auto TearDown() -> void {
+        }
+
+    protected:
+        BinaryTree<int, BALANCE_AVL> m_tree;
+    }; // class FrozenBinaryTreeTest
+/***********************************************************/
+    TEST_F(FrozenBinaryTreeTest, test_freeze)
+    /**
+     * @brief Test a snapshot finds every element of the tree and none
+     *        of the others, for every size up to 70
+     */
+    {
+        //Arrange
+        //Expect
+        EXPECT_TRUE(m_tree.freeze().empty());
+        EXPECT_EQ(nullptr, m_tree.freeze().find(1));
+        //Assert
+        for ( auto n(1); n <= 70; ++n ) {
+            m_tree.insert(2 * n);
+            const auto frozen = m_tree.freeze();
+            ASSERT_EQ(static_cast<std::size_t>(n), frozen.size());
+            for ( auto i(0); i <= 2 * n + 1; ++i ) {
+                ASSERT_EQ(0 == i % 2 && 0 != i, frozen.contains(i));
+                const auto bound = frozen.lowerBound(i);
+                if (i > 2 * n) {
+                    ASSERT_EQ(nullptr, bound);
+                } else {
+                    ASSERT_NE(nullptr, bound);
+                    ASSERT_EQ((0 == i) ? 2 : i + i % 2, *bound);
+                }
+            }
+        }
+    }
+/***********************************************************/
+    TEST_F(FrozenBinaryTreeTest, test_random)
+    /**
+     * @brief Test a snapshot of random keys with duplicates is not
+     *        changed by later updates of the tree
+     */
+    {
+        //Arrange
+        std::multiset<int> reference;
+        std::srand(22);
+        for ( auto i(0); i < 5000; ++i ) {
+            const auto key = std::rand() % 20000;
+            m_tree.insert(key);
+            reference.insert(key);
+        }
+        const auto frozen = m_tree.freeze();
+        m_tree.clear();
+        //Expect
+        //Assert
+        ASSERT_EQ(reference.size(), frozen.size());
+        for ( auto i(-1); i <= 20000; ++i ) {
+            ASSERT_EQ(0 != reference.count(i), frozen.contains(i));
+            const auto itr = reference.lower_bound(i);
+            const auto bound = frozen.lowerBound(i);
+            if (reference.end() == itr) ASSERT_EQ(nullptr, bound);
+            else ASSERT_EQ(*itr, *bound);
+        }
+    }
+/***********************************************************/
+}; // namespace test
@@ -0,0 +1,174 @@
+/** @file IntrusiveLinkedListTest.cpp
+ *  @brief Test IntrusiveLinkedList functionalities
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+/***********************************************************
+ *               Gtest includes
+***********************************************************/
+#include <gtest/gtest.h>
+
+/***********************************************************
+ *                   std includes
+***********************************************************/
+#include <algorithm>
+#include <vector>
+
+/***********************************************************
+ *               Internal includes
+***********************************************************/
+#include "../DataStructures/IntrusiveLinkedList.hpp"
+
+/***********************************************************
+ *                   defines
+***********************************************************/
+#define INTRUSIVE_LIST_SIZE  (5)
+
+/*******************************************************//**
+* @namespace : test
+*
+***********************************************************/
+namespace test {
+   /** @struct ReadyTag
+    *  @brief Tag of the second hook of Task
+    */
+    struct ReadyTag {};
+   /** @struct Task
+    *  @brief Object that can be linked on two lists at once
+    */
+    struct Task : public IntrusiveHook<>, public IntrusiveHook<ReadyTag> {
+        int value {0};
+    }; // struct Task
+
+   /** @class IntrusiveLinkedListTest
+    *  @brief This class test IntrusiveLinkedList functionalites
+    */
+    class IntrusiveLinkedListTest : public ::testing::Test {
+    public:
+        auto SetUp() -> void {
+            for ( auto i(0); i < INTRUSIVE_LIST_SIZE; ++i )
+                m_tasks[i].value = i;
+        }
+
+        auto TearDown() -> void {
+            m_list.clear();
+        }
+
+    protected:
+        Task m_tasks[INTRUSIVE_LIST_SIZE];
+        IntrusiveLinkedList<Task> m_list;
+
+        void init() {
+            for ( auto &task : m_tasks )
+                m_list.add(task);
+        }
+
+        auto values() const -> std::vector<int> {
+            std::vector<int> out;
+            for ( const auto &task : m_list )
+                out.push_back(task.value);
+            return out;
+        }
+    }; // class IntrusiveLinkedListTest
+/***********************************************************/
+    TEST_F(IntrusiveLinkedListTest, test_add)
+    /**
+     * @brief Test add and addFront link the objects themselves
+     */
+    {
+        //Arrange
+        Task first;
+        first.value = -1;
+        init();
+        m_list.addFront(first);
+        //Expect
+        EXPECT_THROW(m_list.add(m_tasks[0]), Exception);
+        //Assert
+        EXPECT_EQ(INTRUSIVE_LIST_SIZE + 1, m_list.size());
+        EXPECT_EQ(&first, &m_list.front());
+        EXPECT_EQ(&m_tasks[INTRUSIVE_LIST_SIZE - 1], &m_list.back());
+        EXPECT_EQ((std::vector<int> {-1, 0, 1, 2, 3, 4}), values());
+        m_list.remove(first);
+    }
+/***********************************************************/
+    TEST_F(IntrusiveLinkedListTest, test_remove)
+    /**
+     * @brief Test remove unlinks an object from its address
+     */
+    {
+        //Arrange
+        init();
+        m_list.remove(m_tasks[2]);
+        m_list.remove(m_tasks[0]);
+        //Expect
+        EXPECT_THROW(m_list.remove(m_tasks[2]), Exception);
+        //Assert
+        EXPECT_FALSE(m_tasks[2].IntrusiveHook<>::linked());
+        EXPECT_EQ(3, m_list.size());
+        EXPECT_EQ((std::vector<int> {1, 3, 4}), values());
+        m_list.add(m_tasks[2]);
+        EXPECT_EQ(2, m_list.back().value);
+    }
+/***********************************************************/
+    TEST_F(IntrusiveLinkedListTest, test_popFront_popBack)
+    /**
+     * @brief Test popFront and popBack return the unlinked objects
+     */
+    {
+        //Arrange
+        init();
+        //Expect
+        //Assert
+        EXPECT_EQ(&m_tasks[0], m_list.popFront());
+        EXPECT_EQ(&m_tasks[4], m_list.popBack());
+        EXPECT_EQ(3, m_list.size());
+        m_list.clear();
+        EXPECT_TRUE(m_list.empty());
+        EXPECT_EQ(nullptr, m_list.popFront());
+        EXPECT_EQ(nullptr, m_list.popBack());
+        EXPECT_THROW(m_list.front(), Exception);
+        EXPECT_FALSE(m_tasks[2].IntrusiveHook<>::linked());
+    }
+/***********************************************************/
+    TEST_F(IntrusiveLinkedListTest, test_insert_reverse)
+    /**
+     * @brief Test insert before an iterator and reverse
+     */
+    {
+        //Arrange
+        Task extra;
+        extra.value = 10;
+        init();
+        m_list.insert(extra, m_list.iteratorTo(m_tasks[3]));
+        m_list.reverse();
+        //Expect
+        //Assert
+        EXPECT_EQ((std::vector<int> {4, 3, 10, 2, 1, 0}), values());
+        EXPECT_EQ(4, m_list.begin()->value);
+        EXPECT_EQ(0, std::prev(m_list.end())->value);
+        m_list.remove(extra);
+    }
+/***********************************************************/
+    TEST_F(IntrusiveLinkedListTest, test_two_hooks)
+    /**
+     * @brief Test an object linked on two lists through two hooks
+     */
+    {
+        //Arrange
+        IntrusiveLinkedList<Task, ReadyTag> ready;
+        init();
+        ready.add(m_tasks[3]);
+        ready.add(m_tasks[1]);
+        m_list.remove(m_tasks[3]);
+        //Expect
+        //Assert
+        EXPECT_EQ(2, ready.size());
+        EXPECT_EQ(3, ready.front().value);
+        EXPECT_EQ(1, ready.back().value);
+        EXPECT_EQ((std::vector<int> {0, 1, 2, 4}), values());
+        EXPECT_EQ(1, std::count_if(ready.begin(), ready.end(),
+                                   []( const Task &task ) { return task.value < 2; }));
+    }
+/***********************************************************/
+}; // namespace test
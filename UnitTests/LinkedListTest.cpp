@@ -9,6 +9,18 @@
 ***********************************************************/
 #include <gtest/gtest.h>
 
+/***********************************************************
+ *                   std includes
+***********************************************************/
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
 /***********************************************************
  *               Internal includes
 ***********************************************************/
@@ -19,6 +31,19 @@
 * 
 ***********************************************************/
 namespace test {
+   /** @struct CopyCounter
+    *  @brief Data type counting how many times it is copied
+    */
+    struct CopyCounter {
+        static int copies;
+        int value {0};
+        CopyCounter( int v ) : value(v) {}
+        CopyCounter( int v, int w ) : value(v + w) {}
+        CopyCounter( const CopyCounter &other ) : value(other.value) { copies++; }
+        CopyCounter( CopyCounter && ) = default;
+    }; // struct CopyCounter
+    int CopyCounter::copies = 0;
+
    /** @class LinkedListTest
     *  @brief This class test LinkedList functionalites
     */
@@ -100,6 +125,27 @@ namespace test {
         //Cleanup
         clear();
     }
+/***********************************************************/
+    TEST_F(LinkedListTest, test_remove_tail)
+    /**
+     * @brief Test removing the last element keeps the list usable
+     * 
+     */
+    {
+        //Arrange
+        init();
+        m_linkedList.remove(4);
+        m_linkedList.remove(0);
+        m_linkedList.add(5);
+        //Expect
+        //Assert
+        ASSERT_EQ(4, m_linkedList.size());
+        ASSERT_EQ(1, m_linkedList.front());
+        ASSERT_EQ(5, m_linkedList.back());
+        ASSERT_EQ(3, m_linkedList[2]);
+        //Cleanup
+        clear();
+    }
 /***********************************************************/
     TEST_F(LinkedListTest, test_clear)
     /**
@@ -269,6 +315,212 @@ namespace test {
         EXPECT_THROW(m_linkedList.insert(100, itr), Exception);
         //Assert
     }   
+/***********************************************************/
+    TEST_F(LinkedListTest, test_insert_index)
+    /**
+     * @brief Test positional insert function of LinkedList class
+     */
+    {
+        //Arrange
+        init();
+        m_linkedList.insert(-1, 0);
+        m_linkedList.insert(-2, 3);
+        m_linkedList.insert(-3, m_linkedList.size());
+        //Expect
+        EXPECT_THROW(m_linkedList.insert(0, m_linkedList.size() + 1), Exception);
+        //Assert
+        EXPECT_EQ(8, m_linkedList.size());
+        EXPECT_EQ(-1, m_linkedList[0]);
+        EXPECT_EQ(-2, m_linkedList[3]);
+        EXPECT_EQ(2, m_linkedList[4]);
+        EXPECT_EQ(-3, m_linkedList.back());
+        //Cleanup
+        clear();
+    }
+/***********************************************************/
+    TEST_F(LinkedListTest, test_enableIndex)
+    /**
+     * @brief Test the positional index stays consistent with
+     *        the list through every mutator
+     */
+    {
+        //Arrange
+        init();
+        m_linkedList.enableIndex();
+        std::vector<int> expected {0, 1, 2, 3, 4};
+        std::srand(0);
+        for ( auto i(0); i < 2000; ++i ) {
+            const int value = std::rand() % 100;
+            switch (std::rand() % 6) {
+            case 0: m_linkedList.add(value); expected.push_back(value); break;
+            case 1: m_linkedList.addFront(value); expected.insert(expected.begin(), value); break;
+            case 2: {
+                const std::size_t index = std::rand() % (expected.size() + 1);
+                m_linkedList.insert(value, index);
+                expected.insert(expected.begin() + index, value);
+                break;
+            }
+            case 3:
+                if (!expected.empty()) {
+                    m_linkedList.popFront();
+                    expected.erase(expected.begin());
+                }
+                break;
+            case 4:
+                if (!expected.empty()) {
+                    m_linkedList.popBack();
+                    expected.pop_back();
+                }
+                break;
+            default: {
+                m_linkedList.remove(value);
+                auto found = std::find(expected.begin(), expected.end(), value);
+                if (found != expected.end()) expected.erase(found);
+                break;
+            }
+            }
+        }
+        //Expect
+        //Assert
+        EXPECT_TRUE(m_linkedList.indexed());
+        ASSERT_EQ(expected.size(), m_linkedList.size());
+        for ( std::size_t i(0); i < expected.size(); ++i )
+            ASSERT_EQ(expected[i], m_linkedList[i]);
+        m_linkedList.reverse();
+        for ( std::size_t i(0); i < expected.size(); ++i )
+            ASSERT_EQ(expected[expected.size() - 1 - i], m_linkedList[i]);
+        m_linkedList.disableIndex();
+        EXPECT_FALSE(m_linkedList.indexed());
+        ASSERT_EQ(expected.front(), m_linkedList[expected.size() - 1]);
+        //Cleanup
+        clear();
+    }
+/***********************************************************/
+    TEST_F(LinkedListTest, test_emplace)
+    /**
+     * @brief Test rvalue and emplace functions never copy data
+     */
+    {
+        //Arrange
+        LinkedList<CopyCounter> list;
+        CopyCounter::copies = 0;
+        list.add(CopyCounter(1));
+        list.addFront(CopyCounter(0));
+        list.emplace_back(3, 4);
+        list.emplace_front(-1);
+        list.emplace(2, 10);
+        //Expect
+        //Assert
+        EXPECT_EQ(0, CopyCounter::copies);
+        EXPECT_EQ(5, list.size());
+        EXPECT_EQ(-1, list.front().value);
+        EXPECT_EQ(10, list[2].value);
+        EXPECT_EQ(7, list.back().value);
+        list.back().value = 8;
+        EXPECT_EQ(8, list[4].value);
+    }
+/***********************************************************/
+    TEST_F(LinkedListTest, test_add_move)
+    /**
+     * @brief Test add of an rvalue moves the data into the list
+     */
+    {
+        //Arrange
+        LinkedList<std::string> list;
+        std::string data(100, 'a');
+        list.add(std::move(data));
+        //Expect
+        //Assert
+        EXPECT_TRUE(data.empty());
+        EXPECT_EQ(std::string(100, 'a'), list.front());
+    }
+/***********************************************************/
+    TEST_F(LinkedListTest, test_addRange)
+    /**
+     * @brief Test addRange and append functions of LinkedList class
+     */
+    {
+        //Arrange
+        init();
+        m_linkedList.enableIndex();
+        const std::vector<int> values {10, 11, 12};
+        m_linkedList.addRange(values.begin(), values.end());
+        m_linkedList.append({20, 21});
+        m_linkedList.addRange(values.end(), values.end());
+        //Expect
+        //Assert
+        EXPECT_EQ(10, m_linkedList.size());
+        EXPECT_EQ(4, m_linkedList[4]);
+        EXPECT_EQ(10, m_linkedList[5]);
+        EXPECT_EQ(12, m_linkedList[7]);
+        EXPECT_EQ(21, m_linkedList.back());
+        m_linkedList.popBack();
+        EXPECT_EQ(20, m_linkedList.back());
+        //Cleanup
+        clear();
+    }
+/***********************************************************/
+    TEST_F(LinkedListTest, test_splice)
+    /**
+     * @brief Test splice function of LinkedList class
+     */
+    {
+        //Arrange
+        init();
+        LinkedList<int> other;
+        other.append({5, 6, 7});
+        m_linkedList.splice(std::move(other));
+        other.add(8);
+        //Expect
+        //Assert
+        EXPECT_EQ(8, m_linkedList.size());
+        EXPECT_EQ(5, m_linkedList[5]);
+        EXPECT_EQ(7, m_linkedList.back());
+        EXPECT_EQ(1, other.size());
+        EXPECT_EQ(8, other.front());
+        m_linkedList.remove(6);
+        EXPECT_EQ(7, m_linkedList[6]);
+        //Cleanup
+        clear();
+    }
+/***********************************************************/
+    TEST_F(LinkedListTest, test_popFront_count)
+    /**
+     * @brief Test popFront of several elements
+     */
+    {
+        //Arrange
+        init();
+        //Expect
+        //Assert
+        EXPECT_EQ(2, m_linkedList.popFront(2));
+        EXPECT_EQ(3, m_linkedList.size());
+        EXPECT_EQ(2, m_linkedList.front());
+        EXPECT_EQ(3, m_linkedList.popFront(10));
+        EXPECT_TRUE(m_linkedList.empty());
+        m_linkedList.add(1);
+        EXPECT_EQ(1, m_linkedList.back());
+        //Cleanup
+        clear();
+    }
+/***********************************************************/
+    TEST_F(LinkedListTest, test_drainTo)
+    /**
+     * @brief Test drainTo function of LinkedList class
+     */
+    {
+        //Arrange
+        LinkedList<std::string> list;
+        list.append({"a", "b", "c"});
+        std::vector<std::string> out;
+        list.drainTo(std::back_inserter(out));
+        list.add("d");
+        //Expect
+        //Assert
+        EXPECT_EQ((std::vector<std::string> {"a", "b", "c"}), out);
+        EXPECT_EQ(1, list.size());
+        EXPECT_EQ("d", list.front());
+    }
 /***********************************************************/
     TEST_F(LinkedListTest, test_begin)
     /**
@@ -281,7 +533,9 @@ namespace test {
         LinkedList<int>::Iterator itr = m_linkedList.begin();
         //Expect
         //Assert
-        EXPECT_EQ(0, itr->data);
+        EXPECT_EQ(0, *itr);
+        EXPECT_EQ(m_linkedList.begin(), itr);
+        EXPECT_EQ(m_linkedList.end(), LinkedList<int>().begin());
         //Cleanup
         clear();
     }
@@ -297,7 +551,193 @@ namespace test {
         LinkedList<int>::Iterator itr = m_linkedList.end();
         //Expect
         //Assert
-        EXPECT_EQ(4, itr->data);
+        EXPECT_NE(m_linkedList.begin(), itr);
+        EXPECT_EQ(4, *--itr);
+        EXPECT_EQ(5, std::distance(m_linkedList.begin(), m_linkedList.end()));
+        //Cleanup
+        clear();
+    }
+/***********************************************************/
+    TEST_F(LinkedListTest, test_iterators)
+    /**
+     * @brief Test iterators with range-for and std algorithms
+     */
+    {
+        //Arrange
+        init();
+        auto first = m_linkedList.begin();
+        auto second = m_linkedList.begin();
+        ++second;
+        for ( auto &data : m_linkedList )
+            data *= 2;
+        const auto &list = m_linkedList;
+        //Expect
+        //Assert
+        EXPECT_EQ(0, *first);
+        EXPECT_EQ(2, *second);
+        EXPECT_EQ(20, std::accumulate(list.begin(), list.end(), 0));
+        EXPECT_EQ(6, *std::prev(std::find(list.cbegin(), list.cend(), 8)));
+        EXPECT_EQ(list.end(), list.find(5));
+        LinkedList<int>::ConstIterator found = m_linkedList.find(4);
+        EXPECT_EQ(m_linkedList.find(4), found);
+        std::vector<int> reversed(std::make_reverse_iterator(list.end()),
+                                  std::make_reverse_iterator(list.begin()));
+        EXPECT_EQ((std::vector<int> {8, 6, 4, 2, 0}), reversed);
+        m_linkedList.insert(10, m_linkedList.end());
+        EXPECT_EQ(10, m_linkedList.back());
+        //Cleanup
+        clear();
+    }
+/***********************************************************/
+    TEST_F(LinkedListTest, test_parallel)
+    /**
+     * @brief Test parallelForEach and parallelReduce over several chunks
+     */
+    {
+        //Arrange
+        const long long n = 4 * PARALLEL_MIN_CHUNK + 3;
+        for ( long long i(0); i < n; ++i )
+            m_linkedList.add(static_cast<int>(i));
+        m_linkedList.parallelForEach([]( int &data ) { data += 1; }, 4);
+        //Expect
+        EXPECT_THROW(m_linkedList.parallelForEach([]( int &data ) {
+            if (data == 3 * PARALLEL_MIN_CHUNK) throw Exception("stop");
+        }, 4), Exception);
+        //Assert
+        auto sum = m_linkedList.parallelReduce(0LL,
+            []( long long value, const int &data ) { return value + data; },
+            []( long long a, long long b ) { return a + b; }, 4);
+        EXPECT_EQ(n * (n + 1) / 2, sum);
+        auto ordered = m_linkedList.parallelReduce(true,
+            []( bool value, const int &data ) { return value && data > 0; },
+            []( bool a, bool b ) { return a && b; });
+        EXPECT_TRUE(ordered);
+        EXPECT_EQ(7, LinkedList<int>().parallelReduce(7,
+            []( int value, const int & ) { return value; },
+            []( int a, int ) { return a; }));
+        //Cleanup
+        clear();
+    }
+/***********************************************************/
+    TEST_F(LinkedListTest, test_concurrent_readers)
+    /**
+     * @brief Test readers sharing the lock while a writer appends
+     *        and pops elements
+     */
+    {
+        //Arrange
+        init();
+        std::atomic<bool> done {false};
+        std::atomic<int> errors {0};
+        std::vector<std::thread> readers;
+        for ( auto r(0); r < 4; ++r ) {
+            readers.emplace_back([this, &done, &errors]() {
+                while (!done.load()) {
+                    if (m_linkedList.size() < 5 || m_linkedList.front() != 0) errors++;
+                    if (m_linkedList.find(4) == m_linkedList.end()) errors++;
+                    auto lock = m_linkedList.readLock();
+                    int previous = -1;
+                    for ( auto data : m_linkedList ) {
+                        if (data <= previous) errors++;
+                        previous = data;
+                    }
+                }
+            });
+        }
+        for ( auto i(5); i < 2000; ++i ) {
+            m_linkedList.add(i);
+            if (i % 2) m_linkedList.popBack();
+        }
+        done = true;
+        for ( auto &reader : readers )
+            reader.join();
+        //Expect
+        //Assert
+        EXPECT_EQ(0, errors.load());
+        EXPECT_EQ(5 + 997, m_linkedList.size());
+        //Cleanup
+        clear();
+    }
+/***********************************************************/
+    TEST_F(LinkedListTest, test_sort)
+    /**
+     * @brief Test radix sort of integers and merge sort with a
+     *        comparison, both checked against std::stable_sort
+     */
+    {
+        //Arrange
+        std::vector<int> expected;
+        std::srand(7);
+        for ( auto i(0); i < 1000; ++i ) {
+            const auto value = (std::rand() % 2000 - 1000) * ((i % 3) ? 1 : 100000);
+            expected.push_back(value);
+            m_linkedList.add(value);
+        }
+        m_linkedList.enableIndex();
+        m_linkedList.sort();
+        LinkedList<std::string> words;
+        words.append({"pear", "fig", "apple", "kiwi", "plum", "date"});
+        words.sort([]( const std::string &a, const std::string &b ) { return a.size() < b.size(); });
+        //Expect
+        //Assert
+        std::stable_sort(expected.begin(), expected.end());
+        EXPECT_TRUE(std::equal(expected.begin(), expected.end(), m_linkedList.begin(), m_linkedList.end()));
+        EXPECT_EQ(expected.back(), m_linkedList.back());
+        EXPECT_EQ(expected[500], m_linkedList[500]);
+        EXPECT_EQ(expected.front(), *--std::prev(m_linkedList.end(), 999));
+        EXPECT_EQ((std::vector<std::string> {"fig", "pear", "kiwi", "plum", "date", "apple"}),
+                  std::vector<std::string>(words.begin(), words.end()));
+        //Cleanup
+        clear();
+    }
+/***********************************************************/
+    TEST_F(LinkedListTest, test_unique_merge)
+    /**
+     * @brief Test unique and merge of two sorted lists
+     */
+    {
+        //Arrange
+        m_linkedList.append({1, 1, 2, 3, 3, 3, 5, 1});
+        LinkedList<int> other;
+        other.append({0, 2, 4, 6});
+        //Expect
+        //Assert
+        EXPECT_EQ(3, m_linkedList.unique());
+        EXPECT_EQ((std::vector<int> {1, 2, 3, 5, 1}), std::vector<int>(m_linkedList.begin(), m_linkedList.end()));
+        m_linkedList.popBack();
+        m_linkedList.merge(other);
+        EXPECT_TRUE(other.empty());
+        EXPECT_EQ(8, m_linkedList.size());
+        EXPECT_EQ((std::vector<int> {0, 1, 2, 2, 3, 4, 5, 6}), std::vector<int>(m_linkedList.begin(), m_linkedList.end()));
+        EXPECT_EQ(1, m_linkedList.unique([]( const int &a, const int &b ) { return a == b; }));
+        other.add(7);
+        EXPECT_EQ(7, other.back());
+        //Cleanup
+        clear();
+    }
+/***********************************************************/
+    TEST_F(LinkedListTest, test_remove_if)
+    /**
+     * @brief Test remove_if on a small list and on a list large
+     *        enough to be filtered by several threads
+     */
+    {
+        //Arrange
+        init();
+        const int n = 3 * PARALLEL_MIN_CHUNK;
+        LinkedList<int> large;
+        large.enableIndex();
+        for ( auto i(0); i < n; ++i )
+            large.add(i);
+        //Expect
+        //Assert
+        EXPECT_EQ(3, m_linkedList.remove_if([]( const int &data ) { return data % 2 == 0; }));
+        EXPECT_EQ((std::vector<int> {1, 3}), std::vector<int>(m_linkedList.begin(), m_linkedList.end()));
+        EXPECT_EQ(n / 3, large.remove_if([]( const int &data ) { return data % 3 == 0; }, 4));
+        EXPECT_EQ(n - n / 3, large.size());
+        EXPECT_EQ(1, large.front());
+        EXPECT_EQ(n - 1, large.back());
+        EXPECT_EQ(5, large[3]);
         //Cleanup
         clear();
     }
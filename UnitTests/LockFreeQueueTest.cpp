@@ -0,0 +1,126 @@
+/** @file LockFreeQueueTest.cpp
+ *  @brief Test LockFreeQueue functionalities
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+/***********************************************************
+ *               Gtest includes
+***********************************************************/
+#include <gtest/gtest.h>
+
+/***********************************************************
+ *                   std includes
+***********************************************************/
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+/***********************************************************
+ *               Internal includes
+***********************************************************/
+#include "../DataStructures/LockFreeQueue.hpp"
+
+/***********************************************************
+ *                   defines
+***********************************************************/
+#define QUEUE_THREADS        (4)
+#define QUEUE_ITEMS          (20000)
+
+/*******************************************************//**
+* @namespace : test
+*
+***********************************************************/
+namespace test {
+   /** @class LockFreeQueueTest
+    *  @brief This class test LockFreeQueue functionalites
+    */
+    class LockFreeQueueTest : public ::testing::Test {
+    public:
+        auto SetUp() -> void {
+        }
+
+        auto TearDown() -> void {
+        }
+
+    protected:
+        LockFreeQueue<int> m_queue;
+    }; // class LockFreeQueueTest
+/***********************************************************/
+    TEST_F(LockFreeQueueTest, test_add_popFront)
+    /**
+     * @brief Test elements are popped in insertion order
+     */
+    {
+        //Arrange
+        for ( auto i(0); i < 5; ++i )
+            m_queue.add(i);
+        //Expect
+        //Assert
+        ASSERT_EQ(5, m_queue.size());
+        int data = NOT_DEFINED;
+        for ( auto i(0); i < 5; ++i ) {
+            ASSERT_TRUE(m_queue.popFront(data));
+            ASSERT_EQ(i, data);
+        }
+        ASSERT_FALSE(m_queue.popFront(data));
+        ASSERT_TRUE(m_queue.empty());
+    }
+/***********************************************************/
+    TEST_F(LockFreeQueueTest, test_non_trivial_data)
+    /**
+     * @brief Test queue of strings left partially drained
+     */
+    {
+        //Arrange
+        LockFreeQueue<std::string> queue;
+        queue.add("first");
+        queue.add("second");
+        queue.add("third");
+        queue.emplace(2, 'x');
+        //Expect
+        //Assert
+        std::string data;
+        ASSERT_TRUE(queue.popFront(data));
+        ASSERT_EQ("first", data);
+        ASSERT_FALSE(queue.empty());
+        ASSERT_EQ(3, queue.size());
+    }
+/***********************************************************/
+    TEST_F(LockFreeQueueTest, test_concurrent)
+    /**
+     * @brief Test many producers and many consumers, every element
+     *        must be popped exactly once
+     */
+    {
+        //Arrange
+        std::atomic<long long> sum {0};
+        std::atomic<int> popped {0};
+        std::vector<std::thread> threads;
+        for ( auto t(0); t < QUEUE_THREADS; ++t ) {
+            threads.emplace_back([this, t]() {
+                for ( auto i(0); i < QUEUE_ITEMS; ++i )
+                    m_queue.add(t * QUEUE_ITEMS + i);
+            });
+            threads.emplace_back([this, &sum, &popped]() {
+                int data = 0;
+                while (popped.load() < QUEUE_THREADS * QUEUE_ITEMS) {
+                    if (m_queue.popFront(data)) {
+                        sum += data;
+                        popped++;
+                    }
+                }
+            });
+        }
+        for ( auto &thread : threads )
+            thread.join();
+        //Expect
+        //Assert
+        const long long n = QUEUE_THREADS * QUEUE_ITEMS;
+        ASSERT_EQ(n * (n - 1) / 2, sum.load());
+        ASSERT_TRUE(m_queue.empty());
+        ASSERT_EQ(EMPTY, m_queue.size());
+    }
+/***********************************************************/
+}; // namespace test
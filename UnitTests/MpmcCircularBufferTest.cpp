@@ -0,0 +1,149 @@
+/** @file MpmcCircularBufferTest.cpp
+ *  @brief Test MpmcCircularBuffer functionalities
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+/***********************************************************
+ *               Gtest includes
+***********************************************************/
+#include <gtest/gtest.h>
+
+/***********************************************************
+ *                   std includes
+***********************************************************/
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+/***********************************************************
+ *               Internal includes
+***********************************************************/
+#include "../DataStructures/MpmcCircularBuffer.hpp"
+
+/***********************************************************
+ *                   defines
+***********************************************************/
+#define MPMC_BUFFER_SIZE     (16)
+#define MPMC_THREADS         (3)
+
+/*******************************************************//**
+* @namespace : test
+*
+***********************************************************/
+namespace test {
+   /** @brief : Run producers and consumers over buffer with blocking put
+    *           and get, every element must be received exactly once
+    *  @return : sum of the elements received
+    */
+    template < typename Buffer >
+    auto transfer( Buffer &buffer, const int items ) -> long long {
+        std::atomic<long long> sum {0};
+        std::vector<std::thread> threads;
+        for ( auto t(0); t < MPMC_THREADS; ++t ) {
+            threads.emplace_back([&buffer, items, t]() {
+                for ( auto i(0); i < items; ++i )
+                    buffer.put(t * items + i);
+            });
+            threads.emplace_back([&buffer, &sum, items]() {
+                int data = 0;
+                for ( auto i(0); i < items; ++i ) {
+                    buffer.get(data);
+                    sum += data;
+                }
+            });
+        }
+        for ( auto &thread : threads )
+            thread.join();
+        return sum.load();
+    }
+
+   /** @class MpmcCircularBufferTest
+    *  @brief This class test MpmcCircularBuffer functionalites
+    */
+    class MpmcCircularBufferTest : public ::testing::Test {
+    public:
+        auto SetUp() -> void {
+        }
+
+        auto TearDown() -> void {
+        }
+
+    protected:
+        MpmcCircularBuffer<int, MPMC_BUFFER_SIZE> m_buffer;
+    }; // class MpmcCircularBufferTest
+/***********************************************************/
+    TEST_F(MpmcCircularBufferTest, test_try_put_try_get)
+    /**
+     * @brief Test the buffer rejects puts once full and wraps around
+     */
+    {
+        //Arrange
+        int data = NOT_DEFINED;
+        for ( auto i(0); i < MPMC_BUFFER_SIZE; ++i )
+            ASSERT_TRUE(m_buffer.try_put(i));
+        //Expect
+        //Assert
+        ASSERT_FALSE(m_buffer.try_put(MPMC_BUFFER_SIZE));
+        ASSERT_FALSE(m_buffer.try_emplace(MPMC_BUFFER_SIZE));
+        ASSERT_EQ(MPMC_BUFFER_SIZE, m_buffer.count());
+        for ( auto i(0); i < 2 * MPMC_BUFFER_SIZE; ++i ) {
+            ASSERT_TRUE(m_buffer.try_get(data));
+            ASSERT_EQ(i, data);
+            ASSERT_TRUE(m_buffer.try_put(i + MPMC_BUFFER_SIZE));
+        }
+        ASSERT_EQ(MPMC_BUFFER_SIZE, m_buffer.count());
+    }
+/***********************************************************/
+    TEST_F(MpmcCircularBufferTest, test_timeout)
+    /**
+     * @brief Test put_for and get_for give up after their timeout
+     */
+    {
+        //Arrange
+        MpmcCircularBuffer<std::string, 3, ParkWait> buffer;
+        std::string data("a");
+        //Expect
+        //Assert
+        ASSERT_FALSE(buffer.get_for(data, std::chrono::milliseconds(5)));
+        ASSERT_EQ("a", data);
+        for ( auto i(0); i < 3; ++i )
+            ASSERT_TRUE(buffer.put_for(std::to_string(i), std::chrono::milliseconds(5)));
+        const auto start = std::chrono::steady_clock::now();
+        ASSERT_FALSE(buffer.put_for(std::move(data), std::chrono::milliseconds(5)));
+        ASSERT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(5));
+        ASSERT_EQ("a", data);
+        std::thread consumer([&buffer]() {
+            std::string received;
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            buffer.get(received);
+        });
+        ASSERT_TRUE(buffer.put_for(data, std::chrono::seconds(10)));
+        consumer.join();
+        ASSERT_TRUE(buffer.get_for(data, std::chrono::milliseconds(5)));
+        ASSERT_EQ("1", data);
+    }
+/***********************************************************/
+    TEST_F(MpmcCircularBufferTest, test_wait_strategies)
+    /**
+     * @brief Test blocking put and get with every wait strategy
+     */
+    {
+        //Arrange
+        MpmcCircularBuffer<int, 5, BusySpinWait> spin;
+        MpmcCircularBuffer<int, MPMC_BUFFER_SIZE, ParkWait> park;
+        //Expect
+        //Assert
+        const long long n = MPMC_THREADS * 20000LL;
+        ASSERT_EQ(n * (n - 1) / 2, transfer(m_buffer, 20000));
+        ASSERT_EQ(n * (n - 1) / 2, transfer(park, 20000));
+        const long long m = MPMC_THREADS * 200LL;
+        ASSERT_EQ(m * (m - 1) / 2, transfer(spin, 200));
+        ASSERT_TRUE(m_buffer.empty());
+        ASSERT_TRUE(park.empty());
+        ASSERT_TRUE(spin.empty());
+    }
+/***********************************************************/
+}; // namespace test
@@ -0,0 +1,154 @@
+/** @file NodePoolTest.cpp
+ *  @brief Test NodePool methodes
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+/***********************************************************
+ *               Gtest includes
+***********************************************************/
+#include <gtest/gtest.h>
+
+/***********************************************************
+ *                   std includes
+***********************************************************/
+#include <set>
+#include <string>
+#include <vector>
+
+/***********************************************************
+ *               Internal includes
+***********************************************************/
+#include "../Misc/node.hpp"
+
+/*******************************************************//**
+* @namespace : test
+*
+***********************************************************/
+namespace test {
+    /** @class NodePoolTest
+    *  @brief This class is defined to test
+    *         NodePool functionalities
+    */
+    class NodePoolTest : public ::testing::Test {
+    public:
+        auto SetUp() -> void {
+        }
+
+        auto TearDown() -> void {
+        }
+    protected:
+        NodePool<Node<int>> m_pool;
+    }; // class NodePoolTest
+/***********************************************************/
+    TEST_F(NodePoolTest, test_create)
+    /**
+     * @brief Test create function of NodePool class
+     */
+    {
+        //Arrange
+        auto first = createNewNode(m_pool, 1);
+        auto second = createNewNode(m_pool, 2, static_cast<Node<int>*>(nullptr), first);
+        first->next = second;
+        //Expect
+        //Assert
+        ASSERT_NE(first, second);
+        ASSERT_EQ(1, first->data);
+        ASSERT_EQ(2, second->data);
+        ASSERT_EQ(first, second->prev);
+        //Cleanup
+        removeNodes(m_pool, first);
+    }
+/***********************************************************/
+    TEST_F(NodePoolTest, test_destroy)
+    /**
+     * @brief Test that a destroyed node storage is reused
+     */
+    {
+        //Arrange
+        auto node = createNewNode(m_pool, 1);
+        removeNode(m_pool, node);
+        auto reused = createNewNode(m_pool, 2);
+        //Expect
+        //Assert
+        ASSERT_EQ(node, reused);
+        ASSERT_EQ(2, reused->data);
+        //Cleanup
+        removeNodes(m_pool, reused);
+    }
+/***********************************************************/
+    TEST_F(NodePoolTest, test_clear)
+    /**
+     * @brief Test clear of a pool holding non trivial data
+     *        spread over several chunks
+     */
+    {
+        //Arrange
+        NodePool<Node<std::string>> pool;
+        Node<std::string> *head = nullptr;
+        for ( auto i(0); i < 10 * NODE_POOL_MIN_CHUNK; ++i )
+            head = createNewNode(pool, std::string(64, 'a'), head);
+        //Expect
+        //Assert
+        ASSERT_EQ(std::string(64, 'a'), head->data);
+        removeNodes(pool, head);
+        auto node = createNewNode(pool, std::string("b"));
+        ASSERT_EQ("b", node->data);
+        //Cleanup
+        removeNodes(pool, node);
+    }
+/***********************************************************/
+    TEST_F(NodePoolTest, test_merge)
+    /**
+     * @brief Test nodes of a merged pool stay valid and are
+     *        released by the receiving pool
+     */
+    {
+        //Arrange
+        NodePool<Node<int>> other;
+        auto first = createNewNode(other, 1);
+        auto spare = createNewNode(other, 2);
+        removeNode(other, spare);
+        m_pool.merge(other);
+        auto second = createNewNode(m_pool, 3, static_cast<Node<int>*>(nullptr), first);
+        first->next = second;
+        auto fresh = createNewNode(other, 4);
+        //Expect
+        //Assert
+        ASSERT_EQ(1, first->data);
+        ASSERT_EQ(3, second->data);
+        ASSERT_EQ(4, fresh->data);
+        //Cleanup
+        removeNodes(m_pool, first);
+        removeNodes(other, fresh);
+    }
+    TEST_F(NodePoolTest, test_merge_runs)
+    /**
+     * @brief Test the leftover bump area and free list of a merged pool
+     *        are handed out once each after the merge
+     */
+    {
+        //Arrange
+        NodePool<Node<int>> other;
+        std::vector<Node<int>*> nodes;
+        nodes.push_back(m_pool.create(0, nullptr, nullptr));
+        for ( auto i(1); i <= NODE_POOL_MIN_CHUNK + 1; ++i )
+            nodes.push_back(other.create(i, nullptr, nullptr));
+        other.destroy(nodes.back());
+        nodes.pop_back();
+        other.destroy(nodes.back());
+        nodes.pop_back();
+        m_pool.merge(other);
+        const auto merged = nodes.size();
+        for ( auto i(0); i < 4 * NODE_POOL_MIN_CHUNK; ++i )
+            nodes.push_back(m_pool.create(static_cast<int>(merged) + i, nullptr, nullptr));
+        //Expect
+        EXPECT_EQ(nodes.size(), std::set<Node<int>*>(nodes.begin(), nodes.end()).size());
+        //Assert
+        for ( std::size_t i(0); i < nodes.size(); ++i )
+            ASSERT_EQ(static_cast<int>(i), nodes[i]->data);
+        for ( auto node : nodes )
+            m_pool.destroy(node);
+    }
+/***********************************************************/
+}; // namespace test
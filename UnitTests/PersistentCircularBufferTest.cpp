@@ -0,0 +1,132 @@
+/** @file PersistentCircularBufferTest.cpp
+ *  @brief Test PersistentCircularBuffer functionalities
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+/***********************************************************
+ *               Gtest includes
+***********************************************************/
+#include <gtest/gtest.h>
+
+/***********************************************************
+ *                   std includes
+***********************************************************/
+#include <cstdint>
+
+/***********************************************************
+ *                   system includes
+***********************************************************/
+#include <fcntl.h>
+#include <unistd.h>
+
+/***********************************************************
+ *               Internal includes
+***********************************************************/
+#include "../DataStructures/PersistentCircularBuffer.hpp"
+
+/***********************************************************
+ *                   defines
+***********************************************************/
+#define PERSISTENT_BUFFER_PATH   ("/tmp/datastructures_test_ring.log")
+#define PERSISTENT_BUFFER_SIZE   (4)
+// layout of PersistentCircularBuffer<int, 4>: header of five 64 bits
+// words, then records of sequence, checksum, reserved and value
+#define PERSISTENT_TAIL_OFFSET   (32)
+#define PERSISTENT_RECORD_OFFSET (40)
+#define PERSISTENT_RECORD_SIZE   (24)
+
+/*******************************************************//**
+* @namespace : test
+*
+***********************************************************/
+namespace test {
+   /** @class PersistentCircularBufferTest
+    *  @brief This class test PersistentCircularBuffer functionalites
+    */
+    class PersistentCircularBufferTest : public ::testing::Test {
+    public:
+        auto SetUp() -> void {
+            ::unlink(PERSISTENT_BUFFER_PATH);
+        }
+
+        auto TearDown() -> void {
+            ::unlink(PERSISTENT_BUFFER_PATH);
+        }
+    protected:
+        /** @brief : Overwrite bytes of the file as a crash would leave them
+         */
+        auto patch( const off_t offset, const void *data, const std::size_t length ) -> void {
+            const int fd = ::open(PERSISTENT_BUFFER_PATH, O_RDWR);
+            ASSERT_LE(0, fd);
+            ASSERT_EQ(static_cast<ssize_t>(length), ::pwrite(fd, data, length, offset));
+            ::close(fd);
+        }
+    }; // class PersistentCircularBufferTest
+/***********************************************************/
+    TEST_F(PersistentCircularBufferTest, test_reopen)
+    /**
+     * @brief Test the window put before closing the file is found
+     *        when it is opened again
+     */
+    {
+        //Arrange
+        {
+            PersistentCircularBuffer<int, PERSISTENT_BUFFER_SIZE> buffer(PERSISTENT_BUFFER_PATH, SYNC_PERIODIC, 2);
+            for ( auto i(0); i < 7; ++i )
+                buffer.put(i);
+            int data = NOT_DEFINED;
+            ASSERT_TRUE(buffer.get(data));
+            ASSERT_EQ(3, data);
+        }
+        PersistentCircularBuffer<int, PERSISTENT_BUFFER_SIZE> buffer(PERSISTENT_BUFFER_PATH);
+        //Expect
+        EXPECT_THROW((PersistentCircularBuffer<int, 8>(PERSISTENT_BUFFER_PATH)), Exception);
+        EXPECT_THROW(buffer[3], Exception);
+        //Assert
+        ASSERT_EQ(3, buffer.count());
+        ASSERT_EQ(4u, buffer.sequence(0));
+        for ( auto i(0); i < 3; ++i )
+            ASSERT_EQ(4 + i, buffer[i]);
+        buffer.put(7);
+        buffer.flush();
+        ASSERT_EQ(7, buffer[3]);
+        buffer.removeAll();
+        ASSERT_TRUE(buffer.empty());
+    }
+/***********************************************************/
+    TEST_F(PersistentCircularBufferTest, test_recover)
+    /**
+     * @brief Test a record put but not published by the header is
+     *        recovered and a torn record is skipped
+     */
+    {
+        //Arrange
+        {
+            PersistentCircularBuffer<int, PERSISTENT_BUFFER_SIZE> buffer(PERSISTENT_BUFFER_PATH, SYNC_ALWAYS);
+            for ( auto i(0); i < 6; ++i )
+                buffer.put(10 + i);
+        }
+        // the header lost the last put and the record of sequence 3 is torn
+        const std::uint64_t tail = 5;
+        const int torn = 99;
+        patch(PERSISTENT_TAIL_OFFSET, &tail, sizeof(tail));
+        patch(PERSISTENT_RECORD_OFFSET + 3 * PERSISTENT_RECORD_SIZE + 16, &torn, sizeof(torn));
+        PersistentCircularBuffer<int, PERSISTENT_BUFFER_SIZE> buffer(PERSISTENT_BUFFER_PATH);
+        int data = NOT_DEFINED;
+        //Expect
+        //Assert
+        ASSERT_EQ(PERSISTENT_BUFFER_SIZE, buffer.count());
+        ASSERT_EQ(15, buffer[3]);
+        ASSERT_FALSE(buffer.valid(1));
+        ASSERT_THROW(buffer[1], Exception);
+        ASSERT_TRUE(buffer.get(data));
+        ASSERT_EQ(12, data);
+        ASSERT_TRUE(buffer.get(data));
+        ASSERT_EQ(14, data);
+        ASSERT_TRUE(buffer.get(data));
+        ASSERT_EQ(15, data);
+        ASSERT_FALSE(buffer.get(data));
+    }
+/***********************************************************/
+}; // namespace test
@@ -0,0 +1,97 @@
+/** @file SharedCircularBufferTest.cpp
+ *  @brief Test SharedCircularBuffer functionalities
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+/***********************************************************
+ *               Gtest includes
+***********************************************************/
+#include <gtest/gtest.h>
+
+/***********************************************************
+ *                   std includes
+***********************************************************/
+#include <string>
+#include <vector>
+
+/***********************************************************
+ *               Internal includes
+***********************************************************/
+#include "../DataStructures/SharedCircularBuffer.hpp"
+
+/***********************************************************
+ *                   defines
+***********************************************************/
+#define SHARED_BUFFER_NAME   ("/datastructures_test_ring")
+
+/*******************************************************//**
+* @namespace : test
+*
+***********************************************************/
+namespace test {
+   /** @class SharedCircularBufferTest
+    *  @brief This class test SharedCircularBuffer functionalites
+    */
+    class SharedCircularBufferTest : public ::testing::Test {
+    public:
+        auto SetUp() -> void {
+        }
+
+        auto TearDown() -> void {
+            SharedCircularBuffer::remove(SHARED_BUFFER_NAME);
+        }
+    }; // class SharedCircularBufferTest
+/***********************************************************/
+    TEST_F(SharedCircularBufferTest, test_attach)
+    /**
+     * @brief Test bytes written through one mapping are read through
+     *        another mapping of the same object
+     */
+    {
+        //Arrange
+        SharedCircularBuffer producer(SHARED_BUFFER_NAME, SHARED_CREATE, 100);
+        SharedCircularBuffer consumer(SHARED_BUFFER_NAME, SHARED_ATTACH);
+        const std::string message("hello");
+        char received[16] = {};
+        //Expect
+        EXPECT_THROW(SharedCircularBuffer("/datastructures_missing_ring", SHARED_ATTACH), Exception);
+        //Assert
+        ASSERT_EQ(0u, producer.capacity() % 4096);
+        ASSERT_EQ(producer.capacity(), consumer.capacity());
+        ASSERT_EQ(message.size(), producer.write(message.data(), message.size()));
+        ASSERT_EQ(message.size(), consumer.count());
+        ASSERT_EQ(message.size(), consumer.read(received, sizeof(received)));
+        ASSERT_EQ(message, std::string(received));
+        ASSERT_EQ(0u, producer.count());
+    }
+/***********************************************************/
+    TEST_F(SharedCircularBufferTest, test_contiguous_wrap)
+    /**
+     * @brief Test regions crossing the end of the ring are contiguous
+     */
+    {
+        //Arrange
+        SharedCircularBuffer producer(SHARED_BUFFER_NAME, SHARED_CREATE, 1);
+        SharedCircularBuffer consumer(SHARED_BUFFER_NAME, SHARED_ATTACH);
+        const auto capacity = producer.capacity();
+        std::vector<unsigned char> block(capacity - 10, 'x');
+        producer.write(block.data(), block.size());
+        consumer.read(block.data(), block.size());
+        //Expect
+        //Assert
+        auto region = producer.writeRegion();
+        ASSERT_EQ(capacity, region.length);
+        for ( std::size_t i(0); i < 100; ++i )
+            region.data[i] = static_cast<unsigned char>(i);
+        producer.commitWrite(100);
+        ASSERT_EQ(capacity - 100, producer.writeRegion().length);
+        auto view = consumer.readRegion();
+        ASSERT_EQ(100u, view.length);
+        for ( std::size_t i(0); i < 100; ++i )
+            ASSERT_EQ(i, view.data[i]);
+        consumer.commitRead(view.length);
+        ASSERT_EQ(0u, consumer.readRegion().length);
+    }
+/***********************************************************/
+}; // namespace test
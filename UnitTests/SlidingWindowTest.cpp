@@ -0,0 +1,110 @@
+/** @file SlidingWindowTest.cpp
+ *  @brief Test SlidingWindow functionalities
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+/***********************************************************
+ *               Gtest includes
+***********************************************************/
+#include <gtest/gtest.h>
+
+/***********************************************************
+ *                   std includes
+***********************************************************/
+#include <algorithm>
+#include <cstdlib>
+#include <deque>
+
+/***********************************************************
+ *               Internal includes
+***********************************************************/
+#include "../DataStructures/SlidingWindow.hpp"
+
+/***********************************************************
+ *                   defines
+***********************************************************/
+#define WINDOW_SIZE          (7)
+
+/*******************************************************//**
+* @namespace : test
+*
+***********************************************************/
+namespace test {
+   /** @class SlidingWindowTest
+    *  @brief This class test SlidingWindow functionalites
+    */
+    class SlidingWindowTest : public ::testing::Test {
+    public:
+        auto SetUp() -> void {
+        }
+
+        auto TearDown() -> void {
+        }
+
+    protected:
+        SlidingWindow<double, WINDOW_SIZE> m_window;
+    }; // class SlidingWindowTest
+/***********************************************************/
+    TEST_F(SlidingWindowTest, test_aggregates)
+    /**
+     * @brief Test sum, mean, variance, min and max against a full
+     *        recompute of the window after every put
+     */
+    {
+        //Arrange
+        std::deque<double> reference;
+        std::srand(7);
+        //Expect
+        EXPECT_THROW(m_window.min(), Exception);
+        EXPECT_THROW(m_window.max(), Exception);
+        //Assert
+        for ( auto i(0); i < 1000; ++i ) {
+            const double value = (std::rand() % 2001 - 1000) / 10.0;
+            m_window.put(value);
+            reference.push_back(value);
+            if (reference.size() > WINDOW_SIZE) reference.pop_front();
+            double sum(0.0), squares(0.0);
+            for ( auto item : reference ) sum += item;
+            const auto mean = sum / reference.size();
+            for ( auto item : reference ) squares += (item - mean) * (item - mean);
+            ASSERT_EQ(reference.size(), m_window.count());
+            ASSERT_NEAR(sum, m_window.sum(), 1e-6);
+            ASSERT_NEAR(mean, m_window.mean(), 1e-6);
+            ASSERT_NEAR(squares / reference.size(), m_window.variance(), 1e-6);
+            ASSERT_EQ(*std::min_element(reference.begin(), reference.end()), m_window.min());
+            ASSERT_EQ(*std::max_element(reference.begin(), reference.end()), m_window.max());
+            ASSERT_EQ(reference.front(), m_window[0]);
+        }
+    }
+/***********************************************************/
+    TEST_F(SlidingWindowTest, test_resync_clear)
+    /**
+     * @brief Test resync cancels the drift of large values and clear
+     *        empties the window
+     */
+    {
+        //Arrange
+        SlidingWindow<long long, 4> window;
+        window.put(1000000000000LL);
+        window.put(1);
+        window.put(2);
+        window.put(3);
+        window.put(4);
+        window.resync();
+        //Expect
+        //Assert
+        ASSERT_EQ(10.0, window.sum());
+        ASSERT_EQ(2.5, window.mean());
+        ASSERT_EQ(1.25, window.variance());
+        ASSERT_EQ(1, window.min());
+        ASSERT_EQ(4, window.max());
+        window.clear();
+        ASSERT_TRUE(window.empty());
+        ASSERT_EQ(0.0, window.variance());
+        window.put(-5);
+        ASSERT_EQ(-5, window.min());
+        ASSERT_EQ(-5.0, window.mean());
+    }
+/***********************************************************/
+}; // namespace test
@@ -0,0 +1,129 @@
+/** @file SpscCircularBufferTest.cpp
+ *  @brief Test SpscCircularBuffer functionalities
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+/***********************************************************
+ *               Gtest includes
+***********************************************************/
+#include <gtest/gtest.h>
+
+/***********************************************************
+ *                   std includes
+***********************************************************/
+#include <memory>
+#include <string>
+#include <thread>
+
+/***********************************************************
+ *               Internal includes
+***********************************************************/
+#include "../DataStructures/SpscCircularBuffer.hpp"
+
+/***********************************************************
+ *                   defines
+***********************************************************/
+#define SPSC_BUFFER_SIZE     (8)
+#define SPSC_ITEMS           (200000)
+
+/*******************************************************//**
+* @namespace : test
+*
+***********************************************************/
+namespace test {
+   /** @class SpscCircularBufferTest
+    *  @brief This class test SpscCircularBuffer functionalites
+    */
+    class SpscCircularBufferTest : public ::testing::Test {
+    public:
+        auto SetUp() -> void {
+        }
+
+        auto TearDown() -> void {
+        }
+
+    protected:
+        SpscCircularBuffer<int, SPSC_BUFFER_SIZE> m_buffer;
+    }; // class SpscCircularBufferTest
+/***********************************************************/
+    TEST_F(SpscCircularBufferTest, test_try_put_try_get)
+    /**
+     * @brief Test the buffer fills up, drains in order and wraps
+     */
+    {
+        //Arrange
+        int data = NOT_DEFINED;
+        for ( auto i(0); i < SPSC_BUFFER_SIZE; ++i )
+            ASSERT_TRUE(m_buffer.try_put(i));
+        //Expect
+        //Assert
+        ASSERT_FALSE(m_buffer.try_put(SPSC_BUFFER_SIZE));
+        ASSERT_EQ(SPSC_BUFFER_SIZE, m_buffer.count());
+        for ( auto i(0); i < 3 * SPSC_BUFFER_SIZE; ++i ) {
+            ASSERT_TRUE(m_buffer.try_get(data));
+            ASSERT_EQ(i, data);
+            ASSERT_TRUE(m_buffer.try_put(i + SPSC_BUFFER_SIZE));
+        }
+        while (m_buffer.try_get(data)) {}
+        ASSERT_EQ(4 * SPSC_BUFFER_SIZE - 1, data);
+        ASSERT_TRUE(m_buffer.empty());
+    }
+/***********************************************************/
+    TEST_F(SpscCircularBufferTest, test_non_trivial_data)
+    /**
+     * @brief Test move only data, elements left are destroyed with
+     *        the buffer and sizes other than powers of two
+     */
+    {
+        //Arrange
+        SpscCircularBuffer<std::unique_ptr<std::string>, 3> buffer;
+        auto data = std::unique_ptr<std::string>(new std::string("a"));
+        ASSERT_TRUE(buffer.try_put(std::move(data)));
+        ASSERT_TRUE(buffer.try_emplace(new std::string("b")));
+        ASSERT_TRUE(buffer.try_emplace(new std::string("c")));
+        //Expect
+        //Assert
+        auto rejected = std::unique_ptr<std::string>(new std::string("d"));
+        ASSERT_FALSE(buffer.try_put(std::move(rejected)));
+        ASSERT_EQ("d", *rejected);
+        ASSERT_TRUE(buffer.try_get(data));
+        ASSERT_EQ("a", *data);
+        ASSERT_TRUE(buffer.try_put(std::move(rejected)));
+        ASSERT_EQ(3, buffer.count());
+    }
+/***********************************************************/
+    TEST_F(SpscCircularBufferTest, test_concurrent)
+    /**
+     * @brief Test one producer and one consumer, every element is
+     *        received once and in order
+     */
+    {
+        //Arrange
+        long long sum = 0;
+        bool ordered = true;
+        std::thread consumer([this, &sum, &ordered]() {
+            int data = 0, expected = 0;
+            while (expected < SPSC_ITEMS) {
+                if (m_buffer.try_get(data)) {
+                    if (data != expected++) ordered = false;
+                    sum += data;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        for ( auto i(0); i < SPSC_ITEMS; ) {
+            if (m_buffer.try_put(i)) ++i;
+            else std::this_thread::yield();
+        }
+        consumer.join();
+        //Expect
+        //Assert
+        const long long n = SPSC_ITEMS;
+        ASSERT_TRUE(ordered);
+        ASSERT_EQ(n * (n - 1) / 2, sum);
+        ASSERT_TRUE(m_buffer.empty());
+    }
+/***********************************************************/
+}; // namespace test
@@ -0,0 +1,110 @@
+/** @file TimedCircularBufferTest.cpp
+ *  @brief Test TimedCircularBuffer functionalities
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+/***********************************************************
+ *               Gtest includes
+***********************************************************/
+#include <gtest/gtest.h>
+
+/***********************************************************
+ *                   std includes
+***********************************************************/
+#include <chrono>
+
+/***********************************************************
+ *               Internal includes
+***********************************************************/
+#include "../DataStructures/TimedCircularBuffer.hpp"
+
+/***********************************************************
+ *                   defines
+***********************************************************/
+#define TIMED_BUFFER_SIZE    (8)
+
+/*******************************************************//**
+* @namespace : test
+*
+***********************************************************/
+namespace test {
+   /** @class TimedCircularBufferTest
+    *  @brief This class test TimedCircularBuffer functionalites
+    */
+    class TimedCircularBufferTest : public ::testing::Test {
+    public:
+        using Buffer = TimedCircularBuffer<int, TIMED_BUFFER_SIZE>;
+
+        TimedCircularBufferTest() : m_buffer(std::chrono::seconds(5)) {}
+
+        auto SetUp() -> void {
+            m_start = Buffer::TimePoint();
+        }
+
+        auto TearDown() -> void {
+        }
+
+    protected:
+        Buffer m_buffer;
+        Buffer::TimePoint m_start;
+        /** @brief : Time of a number of seconds after m_start
+         */
+        auto at( const int seconds ) const -> Buffer::TimePoint {
+            return m_start + std::chrono::seconds(seconds);
+        }
+    }; // class TimedCircularBufferTest
+/***********************************************************/
+    TEST_F(TimedCircularBufferTest, test_expire)
+    /**
+     * @brief Test elements older than the horizon are dropped by put
+     *        and expire, and size still bounds the buffer
+     */
+    {
+        //Arrange
+        for ( auto i(0); i < 7; ++i )
+            m_buffer.put(i, at(i));
+        //Expect
+        EXPECT_THROW(m_buffer.put(100, at(5)), Exception);
+        //Assert
+        ASSERT_EQ(6, m_buffer.count());
+        ASSERT_EQ(1, m_buffer[0]);
+        ASSERT_EQ(at(1), m_buffer.timestamp(0));
+        ASSERT_EQ(3, m_buffer.expire(at(9)));
+        ASSERT_EQ(4, m_buffer[0]);
+        for ( auto i(0); i < 10; ++i )
+            m_buffer.put(10 + i, at(9));
+        ASSERT_EQ(TIMED_BUFFER_SIZE, m_buffer.count());
+        ASSERT_EQ(12, m_buffer[0]);
+        m_buffer.put(20);
+        ASSERT_EQ(1, m_buffer.count());
+        m_buffer.removeAll();
+        ASSERT_TRUE(m_buffer.empty());
+    }
+/***********************************************************/
+    TEST_F(TimedCircularBufferTest, test_range)
+    /**
+     * @brief Test lowerBound and range queries inside the window
+     */
+    {
+        //Arrange
+        int output[TIMED_BUFFER_SIZE] = {};
+        m_buffer.put(0, at(0));
+        m_buffer.put(1, at(1));
+        m_buffer.put(2, at(1));
+        m_buffer.put(3, at(3));
+        m_buffer.put(4, at(4));
+        //Expect
+        //Assert
+        ASSERT_EQ(0, m_buffer.lowerBound(at(-1)));
+        ASSERT_EQ(1, m_buffer.lowerBound(at(1)));
+        ASSERT_EQ(3, m_buffer.lowerBound(at(2)));
+        ASSERT_EQ(5, m_buffer.lowerBound(at(5)));
+        ASSERT_EQ(3, m_buffer.range(at(1), at(4), output, TIMED_BUFFER_SIZE));
+        ASSERT_EQ(1, output[0]);
+        ASSERT_EQ(3, output[2]);
+        ASSERT_EQ(2, m_buffer.range(at(0), at(5), output, 2));
+        ASSERT_EQ(0, m_buffer.range(at(5), at(9), output, TIMED_BUFFER_SIZE));
+    }
+/***********************************************************/
+}; // namespace test
@@ -0,0 +1,232 @@
+/** @file UnrolledLinkedListTest.cpp
+ *  @brief Test UnrolledLinkedList functionalities
+ *
+ *  @author Massinissa Bandou
+ *  @bug No known bugs.
+ */
+/***********************************************************
+ *               Gtest includes
+***********************************************************/
+#include <gtest/gtest.h>
+
+/***********************************************************
+ *                   std includes
+***********************************************************/
+#include <stdexcept>
+#include <string>
+
+/***********************************************************
+ *               Internal includes
+***********************************************************/
+#include "../DataStructures/UnrolledLinkedList.hpp"
+
+/***********************************************************
+ *                   defines
+***********************************************************/
+#define UNROLLED_LIST_SIZE   (100)
+
+/*******************************************************//**
+* @namespace : test
+*
+***********************************************************/
+namespace test {
+   /** @class UnrolledLinkedListTest
+    *  @brief This class test UnrolledLinkedList functionalites
+    */
+    class UnrolledLinkedListTest : public ::testing::Test {
+    public:
+        auto SetUp() -> void {
+        }
+
+        auto TearDown() -> void {
+        }
+
+    protected:
+        UnrolledLinkedList<int> m_list;
+
+        void init() {
+            for ( auto i(0); i < UNROLLED_LIST_SIZE; ++i )
+                m_list.add(i);
+        }
+    }; // class UnrolledLinkedListTest
+/***********************************************************/
+    TEST_F(UnrolledLinkedListTest, test_add)
+    /**
+     * @brief Test add function spanning several nodes
+     */
+    {
+        //Arrange
+        init();
+        //Expect
+        //Assert
+        ASSERT_EQ(UNROLLED_LIST_SIZE, m_list.size());
+        for ( auto i(0); i < UNROLLED_LIST_SIZE; ++i )
+            ASSERT_EQ(i, m_list[i]);
+    }
+/***********************************************************/
+    TEST_F(UnrolledLinkedListTest, test_addFront)
+    /**
+     * @brief Test addFront function of UnrolledLinkedList
+     */
+    {
+        //Arrange
+        init();
+        m_list.addFront(-1);
+        m_list.addFront(-2);
+        //Expect
+        //Assert
+        ASSERT_EQ(UNROLLED_LIST_SIZE + 2, m_list.size());
+        ASSERT_EQ(-2, m_list[0]);
+        ASSERT_EQ(-1, m_list[1]);
+        ASSERT_EQ(0, m_list[2]);
+    }
+/***********************************************************/
+    TEST_F(UnrolledLinkedListTest, test_insert)
+    /**
+     * @brief Test insert function, including inserts in full nodes
+     */
+    {
+        //Arrange
+        init();
+        for ( auto i(0); i < 10; ++i )
+            m_list.insert(-i, 50);
+        m_list.insert(1000, m_list.size());
+        //Expect
+        EXPECT_THROW(m_list.insert(0, m_list.size() + 1), Exception);
+        //Assert
+        ASSERT_EQ(UNROLLED_LIST_SIZE + 11, m_list.size());
+        ASSERT_EQ(49, m_list[49]);
+        for ( auto i(0); i < 10; ++i )
+            ASSERT_EQ(-9 + i, m_list[50 + i]);
+        ASSERT_EQ(50, m_list[60]);
+        ASSERT_EQ(1000, m_list.back());
+    }
+/***********************************************************/
+    TEST_F(UnrolledLinkedListTest, test_remove)
+    /**
+     * @brief Test remove function of UnrolledLinkedList
+     */
+    {
+        //Arrange
+        init();
+        for ( auto i(0); i < UNROLLED_LIST_SIZE; i += 3 )
+            m_list.insert(7, i);
+        m_list.remove(2, REMOVE_FIRST_OF);
+        m_list.remove(7, REMOVE_OCCURENCE);
+        //Expect
+        //Assert
+        ASSERT_EQ(UNROLLED_LIST_SIZE - 2, m_list.size());
+        ASSERT_EQ(static_cast<std::size_t>(NOT_DEFINED), m_list.find(7));
+        ASSERT_EQ(static_cast<std::size_t>(NOT_DEFINED), m_list.find(2));
+        ASSERT_EQ(2u, m_list.find(3));
+    }
+/***********************************************************/
+    TEST_F(UnrolledLinkedListTest, test_popFront_popBack)
+    /**
+     * @brief Test popFront and popBack until the list is empty
+     */
+    {
+        //Arrange
+        init();
+        m_list.popFront();
+        m_list.popBack();
+        //Expect
+        //Assert
+        ASSERT_EQ(1, m_list.front());
+        ASSERT_EQ(UNROLLED_LIST_SIZE - 2, m_list.back());
+        while (!m_list.empty())
+            m_list.popFront();
+        ASSERT_EQ(EMPTY, m_list.size());
+        EXPECT_THROW(m_list.front(), Exception);
+        m_list.popBack();
+        m_list.add(5);
+        ASSERT_EQ(5, m_list.back());
+    }
+/***********************************************************/
+    TEST_F(UnrolledLinkedListTest, test_reverse)
+    /**
+     * @brief Test reverse function of UnrolledLinkedList
+     */
+    {
+        //Arrange
+        init();
+        m_list.reverse();
+        //Expect
+        //Assert
+        for ( auto i(0); i < UNROLLED_LIST_SIZE; ++i )
+            ASSERT_EQ(UNROLLED_LIST_SIZE - 1 - i, m_list[i]);
+    }
+/***********************************************************/
+    TEST_F(UnrolledLinkedListTest, test_clear)
+    /**
+     * @brief Test clear with non trivially destructible data
+     */
+    {
+        //Arrange
+        UnrolledLinkedList<std::string> list;
+        for ( auto i(0); i < UNROLLED_LIST_SIZE; ++i )
+            list.add(std::to_string(i));
+        list.remove("50");
+        //Expect
+        //Assert
+        ASSERT_EQ("51", list[50]);
+        list.clear();
+        ASSERT_TRUE(list.empty());
+        list.addFront("a");
+        ASSERT_EQ("a", list.front());
+    }
+/***********************************************************/
+    TEST_F(UnrolledLinkedListTest, test_emplace)
+    /**
+     * @brief Test emplace functions of UnrolledLinkedList
+     */
+    {
+        //Arrange
+        UnrolledLinkedList<std::string> list;
+        list.emplace_back(2, 'b');
+        list.emplace_front(1, 'a');
+        list.emplace(1, 3, 'c');
+        list.add(std::string("d"));
+        //Expect
+        //Assert
+        ASSERT_EQ(4, list.size());
+        ASSERT_EQ("a", list.front());
+        ASSERT_EQ("ccc", list[1]);
+        ASSERT_EQ("bb", list[2]);
+        list.back() = "e";
+        ASSERT_EQ("e", list[3]);
+    }
+/***********************************************************/
+    TEST_F(UnrolledLinkedListTest, test_throwing_constructor)
+    /**
+     * @brief Test a constructor throwing when the element needs a new
+     *        node leaves the list as it was, and inserting an element of
+     *        the node being split
+     */
+    {
+        //Arrange
+        UnrolledLinkedList<std::string> list;
+        const auto full = UnrolledNode<std::string>::CAPACITY;
+        for ( std::size_t i(0); i < full; ++i )
+            list.add(std::string(100, 'a' + i));
+        //Expect
+        EXPECT_THROW(list.emplace_back(std::string::npos, 'x'), std::length_error);
+        EXPECT_THROW(list.emplace_front(std::string::npos, 'x'), std::length_error);
+        EXPECT_THROW(list.emplace(1, std::string::npos, 'x'), std::length_error);
+        //Assert
+        ASSERT_EQ(full, list.size());
+        ASSERT_EQ(std::string(100, 'a'), list.front());
+        ASSERT_EQ(std::string(100, 'a' + full - 1), list.back());
+        list.insert(list[full - 1], 1);
+        ASSERT_EQ(full + 1, list.size());
+        ASSERT_EQ(std::string(100, 'a' + full - 1), list[1]);
+        list.popFront();
+        list.popFront();
+        ASSERT_EQ(full - 1, list.size());
+        ASSERT_EQ(std::string(100, 'b'), list.front());
+        ASSERT_EQ(std::string(100, 'a' + full - 1), list.back());
+        list.add("z");
+        ASSERT_EQ("z", list.back());
+    }
+/***********************************************************/
+}; // namespace test
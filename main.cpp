@@ -19,6 +19,20 @@
 #include "UnitTests/CircularBufferTest.cpp"
 #include "UnitTests/BinaryTreeTest.cpp"
 #include "UnitTests/GraphTest.cpp"
+#include "UnitTests/NodePoolTest.cpp"
+#include "UnitTests/UnrolledLinkedListTest.cpp"
+#include "UnitTests/LockFreeQueueTest.cpp"
+#include "UnitTests/IntrusiveLinkedListTest.cpp"
+#include "UnitTests/SpscCircularBufferTest.cpp"
+#include "UnitTests/MpmcCircularBufferTest.cpp"
+#include "UnitTests/SharedCircularBufferTest.cpp"
+#include "UnitTests/SlidingWindowTest.cpp"
+#include "UnitTests/PersistentCircularBufferTest.cpp"
+#include "UnitTests/DynamicCircularBufferTest.cpp"
+#include "UnitTests/TimedCircularBufferTest.cpp"
+#include "UnitTests/FrozenBinaryTreeTest.cpp"
+#include "UnitTests/BPlusTreeTest.cpp"
+#include "UnitTests/ConcurrentBinaryTreeTest.cpp"
 
 int main( int argc, char *argv[] ) {
     ::testing::InitGoogleTest(&argc, argv);